@@ -0,0 +1,80 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/batch.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr std::size_t diagrams_count = 10000;
+constexpr int runs = 3;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+auto generate_site_sets(std::size_t sites_count, std::size_t run) {
+    std::vector<std::vector<point2d_t>> site_sets(diagrams_count);
+
+    std::mt19937 rng(run);
+    std::uniform_real_distribution<double> distrib;
+
+    for (auto& sites : site_sets) {
+        sites.reserve(sites_count);
+        for (std::size_t i = 0; i < sites_count; ++i)
+            sites.emplace_back(distrib(rng) * (width - 1.0), distrib(rng) * (height - 1.0));
+    }
+
+    return site_sets;
+}
+
+template<typename F>
+auto us_per_diagram(F&& f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / diagrams_count;
+}
+
+int main() {
+    const dvoronoi::fortune::config_t config{ dvoronoi::box_t{ -0.5, -0.5, width + 0.5, height + 0.5 } };
+
+    dvoronoi::fortune::batch_t single(1);
+    dvoronoi::fortune::batch_t pooled;
+
+    std::cout << diagrams_count << " diagrams per batch, " << pooled.threads() << " threads" << std::endl;
+
+    for (std::size_t sites_count : { 50, 100, 200, 500 }) {
+        double serial_us = 0, single_us = 0, pooled_us = 0;
+
+        for (int r = 0; r < runs; ++r) {
+            auto site_sets = generate_site_sets(sites_count, r);
+
+            serial_us += us_per_diagram([&site_sets, &config]() {
+                std::vector<dvoronoi::fortune::algorithm::voronoi_diagram_h> diagrams;
+                diagrams.reserve(site_sets.size());
+                for (const auto& sites : site_sets)
+                    diagrams.push_back(dvoronoi::fortune::algorithm::generate(sites, config));
+            });
+
+            single_us += us_per_diagram([&site_sets, &config, &single]() { single.generate(site_sets, config); });
+            pooled_us += us_per_diagram([&site_sets, &config, &pooled]() { pooled.generate(site_sets, config); });
+        }
+
+        std::cout << std::fixed << std::setprecision(2)
+            << "[n = " << std::setw(3) << sites_count << "]"
+            << " serial generate: " << serial_us / runs << "us/diagram"
+            << "\tbatch, 1 thread: " << single_us / runs << "us/diagram"
+            << "\tbatch, " << pooled.threads() << " threads: " << pooled_us / runs << "us/diagram"
+            << std::endl;
+    }
+}
@@ -0,0 +1,123 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/fortune/trace.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr int runs = 5;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+std::vector<point2d_t> make_sites(const std::string& distribution, std::size_t count) {
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+
+    if (distribution == "uniform") {
+        for (std::size_t i = 0; i < count; ++i)
+            sites.emplace_back(distrib(rng) * width, distrib(rng) * height);
+    } else if (distribution == "clustered") {
+        const auto clusters = std::max<std::size_t>(1, static_cast<std::size_t>(std::sqrt(static_cast<double>(count)) / 4));
+        std::vector<point2d_t> centers;
+        for (std::size_t c = 0; c < clusters; ++c)
+            centers.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+        std::normal_distribution<double> normal(0.0, height / (4.0 * std::sqrt(static_cast<double>(clusters))));
+        while (sites.size() < count) {
+            const auto& center = centers[rng() % clusters];
+            auto p = point2d_t{ center.x + normal(rng), center.y + normal(rng) };
+            if (p.x >= 0 && p.x <= width && p.y >= 0 && p.y <= height)
+                sites.push_back(p);
+        }
+    } else if (distribution == "wide") {
+        // a long beach line: few rows of many sites
+        for (std::size_t i = 0; i < count; ++i)
+            sites.emplace_back(distrib(rng) * width * 100, distrib(rng) * height);
+    }
+
+    return sites;
+}
+
+template<typename F>
+double measure(F&& f) {
+    double total = 0;
+    for (int r = 0; r < runs; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    return total / runs;
+}
+
+template<typename beach_line_t>
+void replay_backend(const std::string& name, const dvoronoi::fortune::beach_line_trace_t& trace) {
+    const auto ms = measure([&trace]() {
+        beach_line_t beach_line;
+        dvoronoi::fortune::replay(trace, beach_line);
+    });
+
+    beach_line_t counted;
+    dvoronoi::fortune::replay(trace, counted);
+    std::cout << "  " << std::left << std::setw(14) << name << std::right << std::setw(12) << ms << "ms"
+              << std::setw(12) << counted.rotations() << " rotations" << std::endl;
+}
+
+// usage: benchmark_beach_line [sites count]
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 1000000;
+
+    using dvoronoi::fortune::algorithm;
+    using dvoronoi::fortune::_details::beach_line_t;
+    using dvoronoi::fortune::_details::treap_arc_tree_t;
+
+    std::cout << std::fixed << std::setprecision(3) << count << " sites" << std::endl;
+
+    for (const auto* distribution : { "uniform", "clustered", "wide" }) {
+        const auto sites = make_sites(distribution, count);
+
+        // recorded once, replayed against every backend
+        dvoronoi::fortune::beach_line_trace_t trace;
+        dvoronoi::fortune::workspace_t workspace;
+        algorithm::generate(sites, dvoronoi::fortune::config_t{}, workspace, trace);
+
+        std::cout << "[" << distribution << "] " << trace.events.size() << " events, " << trace.arcs_count() << " arcs" << std::endl;
+        std::cout << " trace replay" << std::endl;
+        replay_backend<beach_line_t<dvoronoi::diag_traits, true>>("red-black", trace);
+        replay_backend<beach_line_t<dvoronoi::diag_traits, true, treap_arc_tree_t>>("treap", trace);
+
+        // the whole sweep, for the share the beach line has in it
+        dvoronoi::fortune::treap_workspace_t treap_workspace;
+        const auto rb_ms = measure([&]() { return algorithm::generate(sites, dvoronoi::fortune::config_t{}, workspace); });
+        const auto treap_ms = measure([&]() { return algorithm::generate(sites, dvoronoi::fortune::config_t{}, treap_workspace); });
+        std::cout << " generate" << std::endl;
+        std::cout << "  " << std::left << std::setw(14) << "red-black" << std::right << std::setw(12) << rb_ms << "ms" << std::endl;
+        std::cout << "  " << std::left << std::setw(14) << "treap" << std::right << std::setw(12) << treap_ms << "ms" << std::endl;
+
+        // both backends order the arcs the same way, so the diagrams are identical
+        auto rb_diagram = algorithm::generate(sites, dvoronoi::fortune::config_t{}, workspace);
+        auto treap_diagram = algorithm::generate(sites, dvoronoi::fortune::config_t{}, treap_workspace);
+        bool same = rb_diagram->vertices.size() == treap_diagram->vertices.size();
+        for (std::size_t i = 0; same && i < rb_diagram->vertices.size(); ++i)
+            same = rb_diagram->vertices[i].point.x == treap_diagram->vertices[i].point.x && rb_diagram->vertices[i].point.y == treap_diagram->vertices[i].point.y;
+        std::cout << " identical diagrams: " << (same ? "yes" : "no") << std::endl;
+    }
+}
@@ -5,9 +5,10 @@
 #include <random>
 #include <chrono>
 #include <numeric>
+#include <iomanip>
 #include <iostream>
 
-//#define JC_VORONOI_IMPLEMENTATION
+// jc_voronoi is enabled with -DDVORONOI_BENCHMARK_JCV=ON
 #ifdef JC_VORONOI_IMPLEMENTATION
 #define JCV_REAL_TYPE double
 #define JCV_ATAN2 atan2
@@ -127,23 +128,23 @@ int main() {
         std::cout
             << "finished run " << std::setw(3) << r << " in "
 #ifdef JC_VORONOI_IMPLEMENTATION
-            << "[jcv] " << jcv << "\t[mygal] " << mygal << "\t[dvoronoi] " << dvoronoi
+            << "[jcv] " << jcv.count() << "ms\t[mygal] " << mygal.count() << "ms\t[dvoronoi] " << dvoronoi.count() << "ms"
 #else
-            << "[mygal] " << mygal << "\t[dvoronoi] " << dvoronoi
+            << "[mygal] " << mygal.count() << "ms\t[dvoronoi] " << dvoronoi.count() << "ms"
 #endif
             << std::endl;
     }
 
 #ifdef JC_VORONOI_IMPLEMENTATION
     const auto avg_jcv_duration = std::reduce(jcv_durations.begin(), jcv_durations.end()) / float(jcv_durations.size());
-    std::cout << "[jcv]      avg: " << std::setw(3) << avg_jcv_duration << std::endl;
+    std::cout << "[jcv]      avg: " << std::setw(3) << avg_jcv_duration.count() << "ms" << std::endl;
 #endif
 
     const auto avg_mygal_duration = std::reduce(mygal_durations.begin(), mygal_durations.end()) / float(mygal_durations.size());
-    std::cout << "[mygal]    avg: " << std::setw(3) << avg_mygal_duration << std::endl;
+    std::cout << "[mygal]    avg: " << std::setw(3) << avg_mygal_duration.count() << "ms" << std::endl;
 
     const auto avg_dvoronoi_duration = std::reduce(dvoronoi_durations.begin(), dvoronoi_durations.end()) / float(dvoronoi_durations.size());
-    std::cout << "[dvoronoi] avg: " << std::setw(3) << avg_dvoronoi_duration << std::endl;
+    std::cout << "[dvoronoi] avg: " << std::setw(3) << avg_dvoronoi_duration.count() << "ms" << std::endl;
 
 #ifdef JC_VORONOI_IMPLEMENTATION
     const auto jcv_relative = 100.0 * (avg_jcv_duration - avg_dvoronoi_duration) / avg_jcv_duration;
@@ -0,0 +1,82 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/common/binary.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+template<typename F>
+auto measure(F&& f) {
+    const auto start = std::chrono::steady_clock::now();
+    auto result = f();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::make_pair(std::move(result), std::chrono::duration<double, std::milli>(end - start).count());
+}
+
+// usage: benchmark_binary [sites count] [file]
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 1000000;
+    const std::filesystem::path path = argc > 2 ? argv[2] : "dvoronoi_benchmark.bin";
+
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * (width - 1.0), distrib(rng) * (height - 1.0));
+
+    const dvoronoi::fortune::config_t config{ dvoronoi::box_t{ -0.5, -0.5, width + 0.5, height + 0.5 } };
+
+    auto [diagram, generate_ms] = measure([&sites, &config]() { return dvoronoi::fortune::algorithm::generate(sites, config); });
+    auto [written, write_ms] = measure([&diagram, &path]() { return dvoronoi::binary::write(*diagram, path); });
+
+    if (!written) {
+        std::cerr << "failed to write " << path << std::endl;
+        return 1;
+    }
+
+    auto [mapped, open_ms] = measure([&path]() { return dvoronoi::binary::mapped_diagram_t::open(path); });
+    if (!mapped) {
+        std::cerr << "failed to map " << path << std::endl;
+        return 1;
+    }
+
+    // touches every ring, so the pages are actually read
+    auto [ring_sizes, walk_ms] = measure([&mapped]() {
+        std::size_t total = 0;
+        for (std::size_t f = 0; f < mapped->faces().size(); ++f)
+            mapped->for_each_half_edge(f, [&total](auto) { ++total; });
+        return total;
+    });
+
+    auto [rebuilt, rebuild_ms] = measure([&mapped]() { return dvoronoi::binary::to_diagram(*mapped); });
+
+    std::cout << std::fixed << std::setprecision(3)
+        << "sites:         " << count << '\n'
+        << "file size:     " << std::filesystem::file_size(path) / (1024.0 * 1024.0) << "MB\n"
+        << "generate:      " << generate_ms << "ms\n"
+        << "write:         " << write_ms << "ms\n"
+        << "open (mmap):   " << open_ms << "ms\n"
+        << "walk rings:    " << walk_ms << "ms (" << ring_sizes << " half edges)\n"
+        << "to_diagram:    " << rebuild_ms << "ms" << std::endl;
+
+    std::filesystem::remove(path);
+}
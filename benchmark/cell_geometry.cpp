@@ -0,0 +1,105 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/common/cell_geometry.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr int runs = 10;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+template<typename F>
+double measure(F&& f) {
+    double total = 0;
+    for (int r = 0; r < runs; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    return total / runs;
+}
+
+// the same quantities from the existing per face helpers
+auto helpers_geometry(const auto& diagram) {
+    dvoronoi::cell_geometry_t geometry;
+    geometry.resize(diagram.faces.size());
+
+    auto centroids = dvoronoi::compute_lloyd_relaxation(diagram);
+
+    for (std::size_t i = 0; i < diagram.faces.size(); ++i) {
+        auto vertices = dvoronoi::data::get_face_vertices(diagram.faces[i]);
+
+        double area = 0, perimeter = 0;
+        auto box = dvoronoi::box_t{ vertices[0].x, vertices[0].y, vertices[0].x, vertices[0].y };
+        for (std::size_t v = 0; v < vertices.size(); ++v) {
+            const auto& p0 = vertices[v];
+            const auto& p1 = vertices[(v + 1) % vertices.size()];
+            area += p0.det(p1);
+            perimeter += p0.dist(p1);
+            box = dvoronoi::box_t{ std::min(box.left, p0.x), std::min(box.bottom, p0.y), std::max(box.right, p0.x), std::max(box.top, p0.y) };
+        }
+
+        geometry.area[i] = area / 2;
+        geometry.perimeter[i] = perimeter;
+        geometry.centroid_x[i] = centroids[i].x;
+        geometry.centroid_y[i] = centroids[i].y;
+        geometry.min_x[i] = box.left;
+        geometry.min_y[i] = box.bottom;
+        geometry.max_x[i] = box.right;
+        geometry.max_y[i] = box.top;
+    }
+
+    return geometry;
+}
+
+// usage: benchmark_cell_geometry [sites count]
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100000;
+
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * (width - 1.0), distrib(rng) * (height - 1.0));
+
+    auto diagram = dvoronoi::fortune::algorithm::generate(sites, dvoronoi::fortune::config_t{ dvoronoi::box_t{ 0, 0, width, height }, true });
+
+    dvoronoi::cell_geometry_t reference;
+    const auto helpers_ms = measure([&diagram, &reference]() { reference = helpers_geometry(*diagram); });
+
+    std::cout << std::fixed << std::setprecision(3) << count << " cells" << std::endl;
+    std::cout << "[per face helpers]     " << helpers_ms << "ms" << std::endl;
+
+    dvoronoi::cell_geometry_t geometry;
+    for (std::size_t threads = 1; threads <= dvoronoi::parallel::thread_count(); threads *= 2) {
+        const auto table_ms = measure([&diagram, &geometry, threads]() { dvoronoi::compute_cell_geometry(*diagram, geometry, threads); });
+        std::cout << "[table, " << std::setw(2) << threads << " threads]     " << table_ms << "ms (" << helpers_ms / table_ms << "x)" << std::endl;
+    }
+
+    double total_area = 0, max_error = 0;
+    for (std::size_t i = 0; i < geometry.size(); ++i) {
+        total_area += geometry.area[i];
+        max_error = std::max({ max_error, std::fabs(geometry.area[i] - reference.area[i]), std::fabs(geometry.centroid_x[i] - reference.centroid_x[i]),
+                               std::fabs(geometry.centroid_y[i] - reference.centroid_y[i]), std::fabs(geometry.perimeter[i] - reference.perimeter[i]) });
+    }
+
+    std::cout << std::setprecision(9) << "total area: " << total_area << " (box " << width * height << "), max difference: " << max_error << std::endl;
+}
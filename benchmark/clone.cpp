@@ -0,0 +1,66 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr int runs = 10;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+template<typename F>
+double measure(F&& f) {
+    double total = 0;
+    for (int r = 0; r < runs; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    return total / runs;
+}
+
+// usage: benchmark_clone [sites count]
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100000;
+
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * (width - 1.0), distrib(rng) * (height - 1.0));
+
+    const dvoronoi::fortune::config_t config{ dvoronoi::box_t{ -0.5, -0.5, width + 0.5, height + 0.5 } };
+    using dvoronoi::fortune::algorithm;
+
+    auto diagram = algorithm::generate(sites, config);
+
+    const auto regenerate_ms = measure([&sites, &config]() { auto copy = algorithm::generate(sites, config); });
+    const auto clone_ms = measure([&diagram]() { auto copy = *diagram; });
+    const auto move_ms = measure([&diagram]() {
+        auto moved = std::move(*diagram);
+        *diagram = std::move(moved);
+    });
+
+    std::cout << std::fixed << std::setprecision(3)
+        << count << " sites" << '\n'
+        << "[regenerate] " << regenerate_ms << "ms\n"
+        << "[clone]      " << clone_ms << "ms (" << regenerate_ms / clone_ms << "x faster)\n"
+        << "[move]       " << move_ms << "ms" << std::endl;
+}
@@ -0,0 +1,163 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <map>
+#include <cmath>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <numeric>
+#include <iostream>
+
+#include "results.hpp"
+
+// regularized incomplete beta function, by its continued fraction (modified Lentz)
+double incomplete_beta(double a, double b, double x) {
+    if (x <= 0)
+        return 0;
+    if (x >= 1)
+        return 1;
+
+    // the fraction converges fast below the mean, the symmetry relation covers the rest
+    if (x > (a + 1) / (a + b + 2))
+        return 1 - incomplete_beta(b, a, 1 - x);
+
+    constexpr double tiny = 1e-300;
+    const auto front = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) + a * std::log(x) + b * std::log(1 - x)) / a;
+
+    double f = 1, c = 1, d = 0;
+    for (int i = 0; i <= 200; ++i) {
+        const int m = i / 2;
+        double numerator;
+        if (i == 0)
+            numerator = 1;
+        else if (i % 2 == 0)
+            numerator = (m * (b - m) * x) / ((a + 2 * m - 1) * (a + 2 * m));
+        else
+            numerator = -((a + m) * (a + b + m) * x) / ((a + 2 * m) * (a + 2 * m + 1));
+
+        d = 1 + numerator * d;
+        d = std::fabs(d) < tiny ? tiny : d;
+        d = 1 / d;
+        c = 1 + numerator / c;
+        c = std::fabs(c) < tiny ? tiny : c;
+
+        const auto cd = c * d;
+        f *= cd;
+        if (std::fabs(1 - cd) < 1e-12)
+            break;
+    }
+
+    return front * (f - 1);
+}
+
+struct samples_t {
+    std::vector<double> values{};
+
+    [[nodiscard]] double mean() const { return std::reduce(values.begin(), values.end()) / static_cast<double>(values.size()); }
+    [[nodiscard]] double variance() const {
+        if (values.size() < 2)
+            return 0;
+
+        const auto m = mean();
+        auto sum = 0.0;
+        for (auto v : values)
+            sum += (v - m) * (v - m);
+        return sum / static_cast<double>(values.size() - 1);
+    }
+};
+
+// two sided p-value of Welch's t-test, whether the means differ without assuming equal variances
+double welch_p_value(const samples_t& a, const samples_t& b) {
+    const auto na = static_cast<double>(a.values.size());
+    const auto nb = static_cast<double>(b.values.size());
+    if (na < 2 || nb < 2)
+        return 1;
+
+    const auto va = a.variance() / na;
+    const auto vb = b.variance() / nb;
+    if (va + vb == 0)
+        return a.mean() == b.mean() ? 1 : 0;
+
+    const auto t = (b.mean() - a.mean()) / std::sqrt(va + vb);
+    const auto df = (va + vb) * (va + vb) / (va * va / (na - 1) + vb * vb / (nb - 1));
+    return incomplete_beta(df / 2, 0.5, df / (df + t * t));
+}
+
+typedef std::tuple<std::string, std::size_t, std::string> group_key_t; // distribution, sites, phase
+
+std::optional<std::map<group_key_t, samples_t>> load(const std::string& path, std::string& revision) {
+    auto rows = results::read(path);
+    if (!rows.has_value()) {
+        std::cerr << "cannot read " << path << std::endl;
+        return std::nullopt;
+    }
+
+    std::map<group_key_t, samples_t> groups;
+    for (auto& row : rows.value()) {
+        if (!row.contains("distribution") || !row.contains("sites") || !row.contains("phase") || !row.contains("ns_per_site"))
+            continue;
+
+        revision = row["revision"];
+        groups[{ row["distribution"], std::stoull(row["sites"]), row["phase"] }].values.push_back(std::stod(row["ns_per_site"]));
+    }
+    return groups;
+}
+
+// usage: benchmark_compare <baseline results> <candidate results> [regression threshold in percent, 5] [significance level, 0.05]
+// compares the ns/site of every distribution, size and phase found in both files, exits with 1 when any of them
+// got slower by more than the threshold with a significant difference, so it can gate an upgrade
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "usage: benchmark_compare <baseline results> <candidate results> [threshold percent] [alpha]" << std::endl;
+        return 2;
+    }
+
+    const auto threshold = argc > 3 ? std::stod(argv[3]) : 5.0;
+    const auto alpha = argc > 4 ? std::stod(argv[4]) : 0.05;
+
+    std::string baseline_revision, candidate_revision;
+    auto baseline = load(argv[1], baseline_revision);
+    auto candidate = load(argv[2], candidate_revision);
+    if (!baseline.has_value() || !candidate.has_value())
+        return 2;
+
+    std::cout << "baseline " << baseline_revision << ", candidate " << candidate_revision << ", threshold " << threshold
+              << "%, alpha " << alpha << std::endl;
+    std::cout << std::left << std::setw(12) << "distribution" << std::right << std::setw(10) << "sites" << "  " << std::left << std::setw(10) << "phase"
+              << std::right << std::setw(14) << "baseline" << std::setw(14) << "candidate" << std::setw(10) << "change" << std::setw(10) << "p" << "  verdict" << std::endl;
+
+    std::size_t regressions = 0, improvements = 0, compared = 0;
+    for (const auto& [key, before] : baseline.value()) {
+        auto it = candidate->find(key);
+        if (it == candidate->end())
+            continue;
+
+        const auto& after = it->second;
+        const auto change = (after.mean() - before.mean()) / before.mean() * 100;
+        const auto p = welch_p_value(before, after);
+
+        std::string verdict = "same";
+        if (p < alpha && change > threshold) {
+            verdict = "REGRESSION";
+            ++regressions;
+        } else if (p < alpha && change < -threshold) {
+            verdict = "improvement";
+            ++improvements;
+        } else if (p < alpha) {
+            verdict = "within threshold";
+        }
+        ++compared;
+
+        const auto& [distribution, sites, phase] = key;
+        std::cout << std::left << std::setw(12) << distribution << std::right << std::setw(10) << sites << "  " << std::left << std::setw(10) << phase
+                  << std::right << std::fixed << std::setprecision(1) << std::setw(14) << before.mean() << std::setw(14) << after.mean()
+                  << std::showpos << std::setw(9) << change << "%" << std::noshowpos << std::setprecision(4) << std::setw(10) << p
+                  << "  " << verdict << std::endl;
+    }
+
+    std::cout << compared << " compared, " << regressions << " regressions, " << improvements << " improvements" << std::endl;
+    return regressions > 0 ? 1 : 0;
+}
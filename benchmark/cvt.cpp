@@ -0,0 +1,102 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <numeric>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/cvt/solver.hpp>
+
+// a stippling like density: a few gaussian blobs over a faint background
+dvoronoi::cvt::density_t make_density(std::size_t size) {
+    dvoronoi::cvt::density_t density{ dvoronoi::box_t{ 0, 0, static_cast<double>(size), static_cast<double>(size) }, size, size };
+    density.values.resize(size * size);
+
+    const std::array<std::array<double, 4>, 3> blobs{ { { 0.3, 0.3, 0.12, 1.0 }, { 0.7, 0.6, 0.18, 0.6 }, { 0.4, 0.8, 0.06, 2.0 } } };
+    for (std::size_t r = 0; r < size; ++r) {
+        for (std::size_t c = 0; c < size; ++c) {
+            const auto x = (static_cast<double>(c) + 0.5) / static_cast<double>(size);
+            const auto y = (static_cast<double>(r) + 0.5) / static_cast<double>(size);
+            double rho = 0.02;
+            for (const auto& [bx, by, radius, weight] : blobs)
+                rho += weight * std::exp(-((x - bx) * (x - bx) + (y - by) * (y - by)) / (radius * radius));
+            density.values[r * size + c] = rho;
+        }
+    }
+
+    return density;
+}
+
+// sites drawn from the density by rejection
+std::vector<dvoronoi::data::point_t> sample(const dvoronoi::cvt::density_t& density, std::size_t count) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    const auto peak = *std::ranges::max_element(density.values);
+
+    std::vector<dvoronoi::data::point_t> sites;
+    while (sites.size() < count) {
+        const auto c = static_cast<std::size_t>(distrib(rng) * static_cast<double>(density.width));
+        const auto r = static_cast<std::size_t>(distrib(rng) * static_cast<double>(density.height));
+        if (distrib(rng) * peak < density.at(r, c))
+            sites.emplace_back(static_cast<double>(c) + distrib(rng), static_cast<double>(r) + distrib(rng));
+    }
+
+    return sites;
+}
+
+// usage: benchmark_cvt [sites count] [iterations] [density size]
+// Lloyd against L-BFGS on a density image: energy and gradient norm along the iterations, and their times
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 4000;
+    const std::size_t iterations = argc > 2 ? std::stoull(argv[2]) : 100;
+    const std::size_t size = argc > 3 ? std::stoull(argv[3]) : 512;
+
+    const auto density = make_density(size);
+    const auto sites = sample(density, count);
+    const dvoronoi::cvt::solver_t solver(density);
+
+    // the cells tile the domain, so their masses add up to the density's
+    const auto evaluation = solver.evaluate(sites);
+    const auto total = std::accumulate(density.values.begin(), density.values.end(), 0.0);
+    const auto integrated = std::accumulate(evaluation.mass.begin(), evaluation.mass.end(), 0.0);
+    std::cout << count << " sites, " << size << " x " << size << " density, integrated mass relative error " << std::scientific << std::setprecision(2)
+              << std::abs(integrated - total) / total << std::endl;
+
+    std::vector<dvoronoi::cvt::result_t> results;
+    for (const auto method : { dvoronoi::cvt::method_t::lloyd, dvoronoi::cvt::method_t::lbfgs })
+        results.push_back(solver.solve(sites, dvoronoi::cvt::options_t{ method, iterations, 0 }));
+
+    std::cout << std::setw(10) << "iteration" << std::setw(16) << "lloyd energy" << std::setw(14) << "gradient" << std::setw(16) << "l-bfgs energy" << std::setw(14)
+              << "gradient" << std::endl;
+    for (std::size_t k = 0; k < iterations; ++k) {
+        if (k > 10 && k % 10 != 0 && k + 1 != iterations)
+            continue;
+
+        std::cout << std::setw(10) << k;
+        for (const auto& result : results) {
+            if (k < result.iterations.size())
+                std::cout << std::setw(16) << result.iterations[k].energy << std::setw(14) << result.iterations[k].gradient_norm;
+            else
+                std::cout << std::setw(16) << "-" << std::setw(14) << "-";
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << std::fixed << std::setprecision(3);
+    for (std::size_t m = 0; m < results.size(); ++m) {
+        double total_ms = 0;
+        std::size_t evaluations = 0;
+        for (const auto& iteration : results[m].iterations) {
+            total_ms += iteration.milliseconds;
+            evaluations += iteration.evaluations;
+        }
+
+        const auto done = results[m].iterations.size();
+        std::cout << (m == 0 ? "lloyd:  " : "l-bfgs: ") << done << " iterations, " << total_ms << "ms, " << total_ms / static_cast<double>(std::max<std::size_t>(1, done))
+                  << "ms per iteration, " << evaluations << " evaluations, final energy " << std::scientific << results[m].iterations.back().energy << std::fixed << std::endl;
+    }
+}
@@ -0,0 +1,281 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <limits>
+#include <numeric>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/common/graph.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+double elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+double squared_distance(const point2d_t& p1, const point2d_t& p2) {
+    return (p1.x - p2.x) * (p1.x - p2.x) + (p1.y - p2.y) * (p1.y - p2.y);
+}
+
+// the baseline: an implicit k-d tree over the points reordered in place, node `node` covering [begin, end), its
+// children numbered 2 node + 1 and 2 node + 2 splitting it at the middle point on alternating axes
+class kd_tree_t {
+public:
+    static constexpr std::size_t leaf_size = 8;
+
+    explicit kd_tree_t(const std::vector<point2d_t>& sites) : points(sites), index(sites.size()) {
+        std::iota(index.begin(), index.end(), 0);
+        splits.resize(4 * points.size() / leaf_size + 4);
+        build(0, 0, points.size(), 0);
+        position.resize(points.size());
+        for (std::size_t p = 0; p < points.size(); ++p)
+            position[index[p]] = p;
+    }
+
+    // the k nearest points other than the query's own, nearest first, as (squared distance, original index)
+    void nearest(std::size_t query, std::size_t k, std::vector<std::pair<double, std::size_t>>& heap) const {
+        heap.clear();
+        nearest(0, 0, points.size(), 0, points[position[query]], query, k, heap);
+        std::sort_heap(heap.begin(), heap.end());
+    }
+
+    // Borůvka's rounds: every component's shortest edge to another, found by one query per point pruned by the
+    // component's best so far and by subtrees lying within the component
+    std::vector<std::pair<std::size_t, std::size_t>> spanning_tree() {
+        const auto n = points.size();
+        std::vector<std::size_t> component(n), parent(n);
+        std::iota(parent.begin(), parent.end(), 0);
+        auto find = [&parent](std::size_t i) {
+            while (parent[i] != i)
+                i = parent[i] = parent[parent[i]];
+            return i;
+        };
+
+        std::vector<std::pair<std::size_t, std::size_t>> tree;
+        while (tree.size() + 1 < n) {
+            for (std::size_t p = 0; p < n; ++p)
+                component[p] = find(index[p]);
+            node_component.assign(4 * n / leaf_size + 4, 0);
+            label(0, 0, n, component);
+
+            std::vector<double> best(n, std::numeric_limits<double>::infinity());
+            std::vector<std::pair<std::size_t, std::size_t>> best_edge(n);
+            for (std::size_t p = 0; p < n; ++p) {
+                const auto c = component[p];
+                auto found = best[c];
+                std::size_t other = n;
+                outside(0, 0, n, 0, p, component, found, other);
+                if (other != n && found < best[c]) {
+                    best[c] = found;
+                    best_edge[c] = { index[p], index[other] };
+                }
+            }
+
+            for (std::size_t c = 0; c < n; ++c) {
+                if (best[c] == std::numeric_limits<double>::infinity())
+                    continue;
+                const auto [a, b] = best_edge[c];
+                if (find(a) != find(b)) {
+                    parent[find(a)] = find(b);
+                    tree.emplace_back(a, b);
+                }
+            }
+        }
+
+        return tree;
+    }
+
+    std::vector<point2d_t> points;
+    std::vector<std::size_t> index;
+
+private:
+    std::vector<std::size_t> position; // by original index
+    std::vector<double> splits;        // by node
+    std::vector<std::size_t> node_component;
+    static constexpr std::size_t mixed = std::numeric_limits<std::size_t>::max();
+
+    static double coordinate(const point2d_t& p, std::size_t axis) { return axis == 0 ? p.x : p.y; }
+
+    void build(std::size_t node, std::size_t begin, std::size_t end, std::size_t axis) {
+        if (end - begin <= leaf_size)
+            return;
+
+        const auto middle = begin + (end - begin) / 2;
+        std::vector<std::size_t> order(end - begin);
+        std::iota(order.begin(), order.end(), begin);
+        std::nth_element(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(middle - begin), order.end(), [this, axis](std::size_t i, std::size_t j) {
+            return coordinate(points[i], axis) < coordinate(points[j], axis);
+        });
+
+        std::vector<point2d_t> p(order.size());
+        std::vector<std::size_t> id(order.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            p[i] = points[order[i]];
+            id[i] = index[order[i]];
+        }
+        std::copy(p.begin(), p.end(), points.begin() + static_cast<std::ptrdiff_t>(begin));
+        std::copy(id.begin(), id.end(), index.begin() + static_cast<std::ptrdiff_t>(begin));
+
+        splits[node] = coordinate(points[middle], axis);
+        build(2 * node + 1, begin, middle, 1 - axis);
+        build(2 * node + 2, middle, end, 1 - axis);
+    }
+
+    void nearest(std::size_t node, std::size_t begin, std::size_t end, std::size_t axis, const point2d_t& q, std::size_t query, std::size_t k,
+                 std::vector<std::pair<double, std::size_t>>& heap) const {
+        if (end - begin <= leaf_size) {
+            for (auto p = begin; p < end; ++p) {
+                if (index[p] == query)
+                    continue;
+                const auto d = squared_distance(points[p], q);
+                if (heap.size() < k) {
+                    heap.emplace_back(d, index[p]);
+                    std::push_heap(heap.begin(), heap.end());
+                } else if (d < heap.front().first) {
+                    std::pop_heap(heap.begin(), heap.end());
+                    heap.back() = { d, index[p] };
+                    std::push_heap(heap.begin(), heap.end());
+                }
+            }
+            return;
+        }
+
+        const auto middle = begin + (end - begin) / 2;
+        const auto delta = coordinate(q, axis) - splits[node];
+        const bool left_first = delta < 0;
+        nearest(left_first ? 2 * node + 1 : 2 * node + 2, left_first ? begin : middle, left_first ? middle : end, 1 - axis, q, query, k, heap);
+        if (heap.size() < k || delta * delta < heap.front().first)
+            nearest(left_first ? 2 * node + 2 : 2 * node + 1, left_first ? middle : begin, left_first ? end : middle, 1 - axis, q, query, k, heap);
+    }
+
+    std::size_t label(std::size_t node, std::size_t begin, std::size_t end, const std::vector<std::size_t>& component) {
+        if (end - begin <= leaf_size) {
+            auto c = component[begin];
+            for (auto p = begin + 1; p < end; ++p) {
+                if (component[p] != c)
+                    c = mixed;
+            }
+            return node_component[node] = c;
+        }
+
+        const auto middle = begin + (end - begin) / 2;
+        const auto left = label(2 * node + 1, begin, middle, component);
+        const auto right = label(2 * node + 2, middle, end, component);
+        return node_component[node] = left == right ? left : mixed;
+    }
+
+    void outside(std::size_t node, std::size_t begin, std::size_t end, std::size_t axis, std::size_t query, const std::vector<std::size_t>& component,
+                 double& found, std::size_t& other) const {
+        if (node_component[node] == component[query])
+            return;
+
+        if (end - begin <= leaf_size) {
+            for (auto p = begin; p < end; ++p) {
+                if (component[p] == component[query])
+                    continue;
+                const auto d = squared_distance(points[p], points[query]);
+                if (d < found) {
+                    found = d;
+                    other = p;
+                }
+            }
+            return;
+        }
+
+        const auto middle = begin + (end - begin) / 2;
+        const auto delta = coordinate(points[query], axis) - splits[node];
+        const bool left_first = delta < 0;
+        outside(left_first ? 2 * node + 1 : 2 * node + 2, left_first ? begin : middle, left_first ? middle : end, 1 - axis, query, component, found, other);
+        if (delta * delta < found)
+            outside(left_first ? 2 * node + 2 : 2 * node + 1, left_first ? middle : begin, left_first ? end : middle, 1 - axis, query, component, found, other);
+    }
+};
+
+// usage: benchmark_graph [sites count] [k]
+// the Euclidean minimum spanning tree and the k nearest neighbour graph, from a generated diagram's Delaunay adjacency
+// and from a k-d tree, timed with and without the generation, and checked against one another
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 200000;
+    const std::size_t k = argc > 2 ? std::stoull(argv[2]) : 8;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+    std::cout << std::fixed << std::setprecision(3) << count << " sites, k = " << k << ", " << dvoronoi::parallel::thread_count() << " threads" << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    const auto diagram = dvoronoi::fortune::algorithm::generate(sites);
+    const auto generate_ms = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    const auto tree = dvoronoi::minimum_spanning_tree(*diagram);
+    const auto tree_ms = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    const auto knn = dvoronoi::nearest_neighbours(*diagram, k);
+    const auto knn_ms = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    kd_tree_t kd_tree(sites);
+    const auto build_ms = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    const auto kd_spanning_tree = kd_tree.spanning_tree();
+    const auto kd_tree_ms = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    std::vector<std::pair<double, std::size_t>> heap;
+    std::vector<std::size_t> kd_knn(count * k);
+    for (std::size_t i = 0; i < count; ++i) {
+        kd_tree.nearest(i, k, heap);
+        for (std::size_t j = 0; j < k; ++j)
+            kd_knn[i * k + j] = heap[j].second;
+    }
+    const auto kd_knn_ms = elapsed_ms(start);
+
+    std::cout << "generate " << generate_ms << "ms, k-d tree build " << build_ms << "ms" << std::endl;
+    std::cout << "spanning tree: delaunay " << std::setw(10) << tree_ms << "ms (" << tree_ms + generate_ms << "ms with generate), k-d tree Boruvka "
+              << std::setw(10) << kd_tree_ms << "ms (" << kd_tree_ms + build_ms << "ms with build)" << std::endl;
+    std::cout << "k nearest:     delaunay " << std::setw(10) << knn_ms << "ms (" << knn_ms + generate_ms << "ms with generate), k-d tree queries "
+              << std::setw(10) << kd_knn_ms << "ms (" << kd_knn_ms + build_ms << "ms with build)" << std::endl;
+
+    // the trees' lengths agree, ties or not, and so do the neighbours' distances
+    double length = 0, kd_length = 0;
+    for (const auto& e : tree)
+        length += e.length;
+    for (const auto& [a, b] : kd_spanning_tree)
+        kd_length += std::sqrt(squared_distance(sites[a], sites[b]));
+
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t j = 0; j < k; ++j) {
+            const auto n1 = knn.of(i)[j], n2 = kd_knn[i * k + j];
+            if (n1 != n2 && (n1 == dvoronoi::no_neighbour || squared_distance(sites[i], sites[n1]) != squared_distance(sites[i], sites[n2])))
+                ++mismatches;
+        }
+    }
+
+    std::cout << "tree edges " << tree.size() << " and " << kd_spanning_tree.size() << ", lengths " << length << " and " << kd_length << " (relative difference "
+              << std::scientific << std::abs(length - kd_length) / kd_length << "), k nearest mismatches " << mismatches << std::endl;
+}
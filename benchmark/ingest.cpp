@@ -0,0 +1,98 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/ingest/binary_pairs.hpp>
+#include <dvoronoi/ingest/csv.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+
+template<typename F>
+auto measure(F&& f) {
+    const auto start = std::chrono::steady_clock::now();
+    auto result = f();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::make_pair(std::move(result), std::chrono::duration<double, std::milli>(end - start).count());
+}
+
+void write_inputs(std::size_t count, const std::filesystem::path& bin_path, const std::filesystem::path& csv_path) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+
+    std::ofstream bin(bin_path, std::ios::binary);
+    std::ofstream csv(csv_path);
+    csv << "x,y\n" << std::setprecision(17);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        dvoronoi::ingest::pair_t pair{ distrib(rng) * (width - 1.0), distrib(rng) * (height - 1.0) };
+        bin.write(reinterpret_cast<const char*>(&pair), sizeof(pair));
+        csv << pair.x << ',' << pair.y << '\n';
+    }
+}
+
+// the usual way of reading such a file, for reference
+auto load_csv_stream(const std::filesystem::path& path) {
+    std::vector<dvoronoi::data::point_t> sites;
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+
+    dvoronoi::data::point_t point;
+    char comma;
+    while (in >> point.x >> comma >> point.y)
+        sites.push_back(point);
+
+    return sites;
+}
+
+void print_extents(const dvoronoi::box_t& box) {
+    std::cout << " extents [" << box.left << ", " << box.bottom << ", " << box.right << ", " << box.top << "]";
+}
+
+// usage: benchmark_ingest [sites count]
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 5000000;
+    const std::filesystem::path bin_path = "dvoronoi_ingest.bin";
+    const std::filesystem::path csv_path = "dvoronoi_ingest.csv";
+
+    write_inputs(count, bin_path, csv_path);
+    std::cout << std::fixed << std::setprecision(2)
+        << count << " sites, csv " << std::filesystem::file_size(csv_path) / (1024.0 * 1024.0) << "MB, binary "
+        << std::filesystem::file_size(bin_path) / (1024.0 * 1024.0) << "MB" << std::endl;
+
+    auto [stream_sites, stream_ms] = measure([&csv_path]() { return load_csv_stream(csv_path); });
+    std::cout << "[csv, ifstream]        " << stream_ms << "ms, " << stream_sites.size() << " sites" << std::endl;
+
+    auto [csv_single, csv_single_ms] = measure([&csv_path]() { return dvoronoi::ingest::load_csv(csv_path, { .header = true, .threads = 1 }); });
+    std::cout << "[csv, 1 thread]        " << csv_single_ms << "ms, " << csv_single->sites.size() << " sites";
+    print_extents(csv_single->extents);
+    std::cout << std::endl;
+
+    auto [csv, csv_ms] = measure([&csv_path]() { return dvoronoi::ingest::load_csv(csv_path, { .header = true }); });
+    std::cout << "[csv, " << dvoronoi::parallel::thread_count() << " threads]        " << csv_ms << "ms, " << csv->sites.size() << " sites";
+    print_extents(csv->extents);
+    std::cout << std::endl;
+
+    auto [mapped, mapped_ms] = measure([&bin_path]() { return dvoronoi::ingest::mapped_sites_t::open(bin_path); });
+    std::cout << "[binary, mmap]         " << mapped_ms << "ms, " << mapped->sites().size() << " sites";
+    print_extents(mapped->extents());
+    std::cout << std::endl;
+
+    auto [diagram, generate_ms] = measure([&mapped]() {
+        return dvoronoi::fortune::algorithm::generate(mapped->sites(), dvoronoi::fortune::config_t{ mapped->extents() });
+    });
+    std::cout << "[generate from mmap]   " << generate_ms << "ms" << std::endl;
+
+    std::filesystem::remove(bin_path);
+    std::filesystem::remove(csv_path);
+}
@@ -0,0 +1,91 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/raster/rasterize.hpp>
+#include <dvoronoi/raster/jump_flood.hpp>
+
+constexpr std::size_t width = 3840;
+constexpr std::size_t height = 2160;
+constexpr int runs = 5;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+double elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// usage: benchmark_jump_flood [sites count]
+// the approximate jump flooded labels against the exact path, generate then rasterize, over a 4k view: times, the
+// pixels labelled with a site farther than the nearest one, and the distance error there
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100000;
+
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+    const auto view = dvoronoi::box_t{ 0, 0, width, height };
+    const auto max_threads = dvoronoi::parallel::thread_count();
+
+    std::vector<dvoronoi::raster::label_t> exact(width * height), approximate(width * height);
+    std::vector<float> distances(width * height);
+
+    std::cout << std::fixed << std::setprecision(2) << count << " sites, " << width << 'x' << height << ", averaged over " << runs << " runs" << std::endl;
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        const auto config = dvoronoi::raster::raster_config_t{ view, width, height, dvoronoi::raster::no_label, threads };
+
+        double exact_ms = 0, flood_ms = 0;
+        for (int r = 0; r < runs; ++r) {
+            auto start = std::chrono::steady_clock::now();
+            const auto diagram = dvoronoi::fortune::algorithm::generate(sites, dvoronoi::fortune::config_t{ view });
+            dvoronoi::raster::rasterize(*diagram, exact, config);
+            exact_ms += elapsed_ms(start) / runs;
+
+            start = std::chrono::steady_clock::now();
+            dvoronoi::raster::jump_flood(sites, approximate, config, distances);
+            flood_ms += elapsed_ms(start) / runs;
+        }
+
+        std::cout << "[" << std::setw(2) << threads << " threads] generate + rasterize " << exact_ms << "ms, jump flood " << flood_ms << "ms ("
+                  << flood_ms / exact_ms << "x)" << std::endl;
+    }
+
+    // the exact labels give every pixel's nearest site, up to ties
+    std::size_t mismatches = 0;
+    double worst = 0, total = 0, distance_error = 0;
+    for (std::size_t p = 0; p < width * height; ++p) {
+        const auto x = static_cast<double>(p % width) + 0.5, y = static_cast<double>(p / width) + 0.5;
+        const auto dist = [&sites, x, y](std::size_t i) { return std::hypot(sites[i].x - x, sites[i].y - y); };
+
+        const auto nearest = dist(exact[p]);
+        distance_error = std::max(distance_error, std::abs(static_cast<double>(distances[p]) - dist(approximate[p])));
+        if (approximate[p] != exact[p] && dist(approximate[p]) - nearest > 1e-6) {
+            ++mismatches;
+            total += dist(approximate[p]) - nearest;
+            worst = std::max(worst, dist(approximate[p]) - nearest);
+        }
+    }
+
+    std::cout << std::setprecision(4) << "mislabelled: " << mismatches << " pixels (" << 100.0 * static_cast<double>(mismatches) / static_cast<double>(width * height)
+              << "%), farther than the nearest site by " << (mismatches ? total / static_cast<double>(mismatches) : 0.0) << " on average, " << worst
+              << " at worst; distance output error " << std::scientific << distance_error << std::endl;
+}
@@ -0,0 +1,59 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/fortune/memory.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+// usage: benchmark_memory [max sites count]
+int main(int argc, char** argv) {
+    const std::size_t max_count = argc > 1 ? std::stoull(argv[1]) : 1000000;
+
+    const dvoronoi::fortune::config_t config{ dvoronoi::box_t{ -0.5, -0.5, width + 0.5, height + 0.5 } };
+    using dvoronoi::fortune::algorithm;
+
+    for (std::size_t count = 10000; count <= max_count; count *= 10) {
+        std::vector<point2d_t> sites;
+        sites.reserve(count);
+
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<double> distrib;
+        for (std::size_t i = 0; i < count; ++i)
+            sites.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+        dvoronoi::fortune::memory_accounting_t accounting;
+        dvoronoi::fortune::workspace_t workspace(accounting.resources());
+
+        const auto start = std::chrono::steady_clock::now();
+        auto diagram = algorithm::generate(sites, config, workspace);
+        const auto end = std::chrono::steady_clock::now();
+
+        std::cout << "[" << count << " sites] " << std::fixed << std::setprecision(3)
+                  << std::chrono::duration<double, std::milli>(end - start).count() << "ms" << std::endl;
+        accounting.report(std::cout);
+
+        const auto n = static_cast<double>(count);
+        std::cout << std::setprecision(1) << "peak bytes per site: event queue " << static_cast<double>(accounting.event_queue().peak_bytes) / n
+                  << ", beach line " << static_cast<double>(accounting.beach_line().peak_bytes) / n
+                  << ", diagram " << static_cast<double>(accounting.diagram().peak_bytes) / n << std::endl << std::endl;
+
+        // the diagram frees its arrays through the accounting
+        diagram.reset();
+    }
+}
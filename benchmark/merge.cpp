@@ -0,0 +1,130 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+#include <unordered_map>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/common/validate.hpp>
+#include <dvoronoi/common/pair_hash.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr int runs = 5;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+double elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// sensor like readings: positions repeated a few times each, exactly or with noise below jitter
+std::vector<point2d_t> make_readings(std::size_t count, std::size_t positions, double jitter) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+
+    std::vector<point2d_t> sensors;
+    for (std::size_t i = 0; i < positions; ++i)
+        sensors.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+    std::vector<point2d_t> readings;
+    readings.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto p = sensors[i < positions ? i : rng() % positions];
+        if (jitter > 0 && i >= positions) {
+            p.x += (distrib(rng) - 0.5) * jitter;
+            p.y += (distrib(rng) - 0.5) * jitter;
+        }
+        readings.push_back(p);
+    }
+
+    return readings;
+}
+
+// what the request replaces: an exact hash set pass, then generate over the unique sites
+auto external_dedup(const std::vector<point2d_t>& readings, const dvoronoi::fortune::config_t& config, std::vector<std::size_t>& faces) {
+    std::unordered_map<std::pair<double, double>, std::size_t, dvoronoi::pair_hash> seen;
+    seen.reserve(readings.size());
+
+    std::vector<point2d_t> unique;
+    faces.resize(readings.size());
+    for (std::size_t i = 0; i < readings.size(); ++i) {
+        auto [it, inserted] = seen.try_emplace({ readings[i].x, readings[i].y }, unique.size());
+        if (inserted)
+            unique.push_back(readings[i]);
+        faces[i] = it->second;
+    }
+
+    return dvoronoi::fortune::algorithm::generate(unique, config);
+}
+
+// every input's face has a site within tolerance of it
+bool mapped(const std::vector<point2d_t>& readings, const dvoronoi::voronoi_diagram_t& diagram, const std::vector<std::size_t>& faces, double tolerance) {
+    for (std::size_t i = 0; i < readings.size(); ++i) {
+        const auto& site = diagram.faces[faces[i]].site->point;
+        if (std::hypot(site.x - readings[i].x, site.y - readings[i].y) > tolerance * 1.000001)
+            return false;
+    }
+    return true;
+}
+
+// usage: benchmark_merge [readings] [positions]
+// generation over sensor like readings with duplicates, deduplicated by a hash set beforehand, merged through the
+// config, exactly and within a tolerance, and not at all
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 200000;
+    const std::size_t positions = argc > 2 ? std::stoull(argv[2]) : 50000;
+    const dvoronoi::box_t box{ -1, -1, width + 1, height + 1 };
+
+    std::cout << std::fixed << std::setprecision(3) << count << " readings of " << positions << " positions, averaged over " << runs << " runs" << std::endl;
+
+    for (const auto jitter : { 0.0, 1e-4 }) {
+        const auto readings = make_readings(count, positions, jitter);
+        std::cout << (jitter == 0 ? "[exact duplicates]" : "[jittered by 1e-4]") << std::endl;
+
+        std::vector<std::size_t> faces;
+        double external_ms = 0;
+        std::unique_ptr<dvoronoi::voronoi_diagram_t> external;
+        for (int r = 0; r < runs; ++r) {
+            const auto start = std::chrono::steady_clock::now();
+            external = external_dedup(readings, dvoronoi::fortune::config_t{ box }, faces);
+            external_ms += elapsed_ms(start) / runs;
+        }
+        std::cout << "  hash set, then generate    " << std::setw(10) << external_ms << "ms, " << external->faces.size() << " faces, "
+                  << (mapped(readings, *external, faces, jitter) ? "mapped" : "NOT MAPPED") << ", " << dvoronoi::validate(*external) << std::endl;
+
+        for (const auto tolerance : { 0.0, 1e-3 }) {
+            dvoronoi::fortune::config_t config{ box };
+            config.merge_tolerance = tolerance;
+
+            dvoronoi::fortune::run_stats_t stats;
+            double merged_ms = 0;
+            std::unique_ptr<dvoronoi::voronoi_diagram_t> merged;
+            for (int r = 0; r < runs; ++r) {
+                const auto start = std::chrono::steady_clock::now();
+                merged = dvoronoi::fortune::algorithm::generate(readings, config, stats);
+                merged_ms += elapsed_ms(start) / runs;
+            }
+            std::cout << "  merged, tolerance " << std::setw(5) << std::defaultfloat << tolerance << std::fixed << "    " << std::setw(10) << merged_ms
+                      << "ms (" << merged_ms / external_ms << "x, merging " << stats.milliseconds(dvoronoi::fortune::phase_t::merge) / runs << "ms), "
+                      << merged->faces.size() << " faces, " << (mapped(readings, *merged, *merged->input_faces, tolerance) ? "mapped" : "NOT MAPPED") << ", "
+                      << dvoronoi::validate(*merged) << std::endl;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto unmerged = dvoronoi::fortune::algorithm::generate(readings, dvoronoi::fortune::config_t{ box });
+        const auto unmerged_ms = elapsed_ms(start);
+        std::cout << "  not merged                 " << std::setw(10) << unmerged_ms << "ms, " << dvoronoi::validate(*unmerged) << std::endl;
+    }
+}
@@ -0,0 +1,78 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/fortune/perf_stats.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr int runs = 5;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+// usage: benchmark_perf [sites count]
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 20000;
+
+    using dvoronoi::fortune::algorithm;
+    using dvoronoi::fortune::phase_t;
+    using dvoronoi::perf::counter_t;
+
+    dvoronoi::perf::counters_t counters;
+    if (!counters.any_available()) {
+        std::cout << "no performance counters available (unsupported platform, perf_event_paranoid or a container's seccomp profile)" << std::endl;
+        return 0;
+    }
+
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+    const dvoronoi::fortune::config_t config{ dvoronoi::box_t{ 0, 0, width, height }, true };
+
+    dvoronoi::fortune::workspace_t workspace;
+    dvoronoi::fortune::perf_stats_t stats(counters);
+    for (int r = 0; r < runs; ++r)
+        algorithm::generate(sites, config, workspace, stats);
+
+    std::cout << count << " sites, per site, averaged over " << runs << " runs" << std::endl;
+    std::cout << std::left << std::setw(14) << "phase";
+    for (std::size_t c = 0; c < static_cast<std::size_t>(counter_t::count); ++c)
+        std::cout << std::right << std::setw(16) << dvoronoi::perf::name(static_cast<counter_t>(c));
+    std::cout << std::setw(8) << "IPC" << std::endl;
+
+    const auto per_site = static_cast<double>(count * runs);
+    const std::array<std::pair<const char*, phase_t>, 4> phases{ {
+        { "queue build", phase_t::queue_build }, { "sweep", phase_t::sweep }, { "bound", phase_t::bound }, { "clip", phase_t::clip } } };
+    for (const auto& [phase_name, phase] : phases) {
+        const auto& sample = stats.phase(phase);
+        std::cout << std::left << std::setw(14) << phase_name << std::right << std::fixed << std::setprecision(2);
+        for (std::size_t c = 0; c < static_cast<std::size_t>(counter_t::count); ++c) {
+            if (counters.available(static_cast<counter_t>(c)))
+                std::cout << std::setw(16) << static_cast<double>(sample.values[c]) / per_site;
+            else
+                std::cout << std::setw(16) << "n/a";
+        }
+
+        if (counters.available(counter_t::cycles) && counters.available(counter_t::instructions) && sample[counter_t::cycles] > 0)
+            std::cout << std::setw(8) << static_cast<double>(sample[counter_t::instructions]) / static_cast<double>(sample[counter_t::cycles]);
+        else
+            std::cout << std::setw(8) << "n/a";
+        std::cout << std::endl;
+    }
+}
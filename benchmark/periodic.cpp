@@ -0,0 +1,99 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr int runs = 5;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+template<typename F>
+double measure(F&& f) {
+    double total = 0;
+    for (int r = 0; r < runs; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        auto diagram = f();
+        const auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    return total / runs;
+}
+
+double megabytes(const auto& diagram) {
+    auto bytes = diagram.sites.capacity() * sizeof(diagram.sites[0]) + diagram.faces.capacity() * sizeof(diagram.faces[0]) +
+                 diagram.vertices.capacity() * sizeof(diagram.vertices[0]) + diagram.half_edges.capacity() * sizeof(diagram.half_edges[0]);
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+// usage: benchmark_periodic [sites count]
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100000;
+
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+    const auto domain = dvoronoi::box_t{ 0, 0, width, height };
+    using dvoronoi::fortune::algorithm;
+
+    // the naive way: the full 3 x 3 tiling, of which only the center cells are kept
+    std::vector<point2d_t> tiled;
+    tiled.reserve(9 * count);
+    tiled.insert(tiled.end(), sites.begin(), sites.end());
+    for (int dx = -1; dx <= 1; ++dx)
+        for (int dy = -1; dy <= 1; ++dy)
+            if (dx != 0 || dy != 0)
+                for (const auto& s : sites)
+                    tiled.emplace_back(s.x + dx * width, s.y + dy * height);
+
+    const dvoronoi::fortune::config_t tiled_config{ dvoronoi::box_t{ -width, -height, 2 * width, 2 * height } };
+    dvoronoi::fortune::config_t periodic_config;
+    periodic_config.periodic = domain;
+
+    std::cout << std::fixed << std::setprecision(3) << count << " sites" << std::endl;
+
+    const auto tiled_ms = measure([&]() { return algorithm::generate(tiled, tiled_config); });
+    auto tiled_diagram = algorithm::generate(tiled, tiled_config);
+    std::cout << "[3 x 3 tiling]  " << tiled_ms << "ms, " << tiled.size() << " sites swept, "
+              << megabytes(*tiled_diagram) << "MB diagram" << std::endl;
+
+    const auto periodic_ms = measure([&]() { return algorithm::generate(sites, periodic_config); });
+
+    // the same steps as the periodic mode, to look at the intermediate diagram
+    std::size_t swept = 0;
+    double swept_megabytes = 0;
+    dvoronoi::fortune::workspace_t workspace;
+    auto periodic_diagram = dvoronoi::fortune::_details::generate_periodic<algorithm::voronoi_diagram_h>(sites, domain,
+        [&](const auto& extended, const dvoronoi::box_t& region) {
+            auto diagram = algorithm::generate(extended, dvoronoi::fortune::config_t{ region }, workspace);
+            swept = extended.size();
+            swept_megabytes = megabytes(*diagram);
+            return diagram;
+        });
+    std::cout << "[periodic]      " << periodic_ms << "ms (" << tiled_ms / periodic_ms << "x faster), " << swept << " sites swept, "
+              << swept_megabytes << "MB diagram, " << megabytes(*periodic_diagram) << "MB result" << std::endl;
+
+    std::size_t unmatched = 0;
+    for (const auto& he : periodic_diagram->half_edges)
+        unmatched += he.twin == nullptr;
+    std::cout << "half edges without twin: " << unmatched << std::endl;
+}
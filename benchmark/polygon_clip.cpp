@@ -0,0 +1,102 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <string>
+#include <numbers>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/common/cell_geometry.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+// clips fresh copies of the bounded diagram, the copies are not timed
+template<typename F>
+double measure(const auto& diagram, int runs, F&& f) {
+    double total = 0;
+    for (int r = 0; r < runs; ++r) {
+        auto copy = diagram;
+        const auto start = std::chrono::steady_clock::now();
+        f(copy);
+        const auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    return total / runs;
+}
+
+double clipped_area(const auto& diagram) {
+    auto geometry = dvoronoi::compute_cell_geometry(diagram);
+
+    double area = 0;
+    for (std::size_t i = 0; i < geometry.size(); ++i)
+        if (diagram.faces[i].half_edge != nullptr)
+            area += geometry.area[i];
+    return area;
+}
+
+// usage: benchmark_polygon_clip [sites count]
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100000;
+
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * (width - 1.0), distrib(rng) * (height - 1.0));
+
+    using dvoronoi::fortune::algorithm;
+    auto diagram = algorithm::generate(sites, dvoronoi::fortune::config_t{ dvoronoi::box_t{ -0.5, -0.5, width + 0.5, height + 0.5 } });
+
+    const auto box = dvoronoi::box_t{ width * 0.1, height * 0.1, width * 0.9, height * 0.9 };
+
+    std::vector<dvoronoi::data::point_t> octagon;
+    for (int i = 0; i < 8; ++i) {
+        auto angle = std::numbers::pi * (2 * i + 1) / 8;
+        octagon.emplace_back(width / 2 + width * 0.45 * std::cos(angle), height / 2 + height * 0.45 * std::sin(angle));
+    }
+
+    const auto box_polygon = dvoronoi::convex_polygon_t::from_box(box);
+    const auto octagon_polygon = dvoronoi::convex_polygon_t::make(octagon).value();
+
+    std::cout << std::fixed << std::setprecision(3) << count << " sites" << std::endl;
+
+    const auto box_polygon_ms = measure(*diagram, 10, [&box_polygon](auto& d) { algorithm::clip(d, box_polygon); });
+    std::cout << "[polygon clip, box]       " << box_polygon_ms << "ms" << std::endl;
+
+    // the box clipper removes edges in quadratic time, a single run is enough and large inputs are skipped
+    if (count <= 20000) {
+        const auto box_ms = measure(*diagram, 1, [&box](auto& d) { algorithm::clip(d, box); });
+        std::cout << "[box clip]                " << box_ms << "ms (" << box_ms / box_polygon_ms << "x slower)" << std::endl;
+    } else
+        std::cout << "[box clip]                skipped above 20000 sites" << std::endl;
+
+    const auto single_ms = measure(*diagram, 10, [&box_polygon](auto& d) { algorithm::clip(d, box_polygon, 1); });
+    std::cout << "[polygon clip, 1 thread]  " << single_ms << "ms" << std::endl;
+
+    const auto octagon_ms = measure(*diagram, 10, [&octagon_polygon](auto& d) { algorithm::clip(d, octagon_polygon); });
+    std::cout << "[polygon clip, octagon]   " << octagon_ms << "ms" << std::endl;
+
+    auto clipped = *diagram;
+    algorithm::clip(clipped, octagon_polygon);
+
+    double octagon_area = 0;
+    for (std::size_t i = 0; i < octagon.size(); ++i)
+        octagon_area += octagon[i].det(octagon[(i + 1) % octagon.size()]) / 2;
+    std::cout << "octagon area: " << clipped_area(clipped) << " (expected " << octagon_area << ")" << std::endl;
+}
@@ -0,0 +1,91 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/power/algorithm.hpp>
+#include <dvoronoi/common/cell_geometry.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr int runs = 5;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+template<typename F>
+double measure(F&& f) {
+    double total = 0;
+    for (int r = 0; r < runs; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        auto diagram = f();
+        const auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    return total / runs;
+}
+
+// usage: benchmark_power [sites count]
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100000;
+
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * (width - 1.0), distrib(rng) * (height - 1.0));
+
+    // weights up to the squared mean spacing, enough to move the bisectors without emptying most cells
+    const auto spacing2 = width * height / static_cast<double>(count);
+    std::vector<double> zero_weights(count, 0.0);
+    std::vector<double> weights(count);
+    for (auto& w : weights)
+        w = distrib(rng) * spacing2;
+
+    const dvoronoi::fortune::config_t config{ dvoronoi::box_t{ -0.5, -0.5, width + 0.5, height + 0.5 } };
+    using dvoronoi::fortune::algorithm;
+
+    std::cout << std::fixed << std::setprecision(3) << count << " sites" << std::endl;
+
+    const auto sweep_ms = measure([&]() { return algorithm::generate(sites, config); });
+    std::cout << "[fortune, unweighted]  " << sweep_ms << "ms" << std::endl;
+
+    const auto zero_ms = measure([&]() { return dvoronoi::power::algorithm::generate(sites, zero_weights, config); });
+    std::cout << "[power, zero weights]  " << zero_ms << "ms (" << zero_ms / sweep_ms << "x)" << std::endl;
+
+    const auto weighted_ms = measure([&]() { return dvoronoi::power::algorithm::generate(sites, weights, config); });
+    std::cout << "[power, weighted]      " << weighted_ms << "ms (" << weighted_ms / sweep_ms << "x)" << std::endl;
+
+    auto weighted = dvoronoi::power::algorithm::generate(sites, weights, config);
+    std::size_t empty = 0;
+    for (const auto& face : weighted->faces)
+        empty += face.half_edge == nullptr;
+    std::cout << "empty weighted cells: " << empty << std::endl;
+
+    // with zero weights the power diagram is the Voronoi diagram; compared clipped, as bounding adds different corners,
+    // and by cell areas, as near cocircular sites can give the sweep an extra vertex at a distance of a few ulps
+    const dvoronoi::fortune::config_t clipped{ dvoronoi::box_t{ 0, 0, width, height }, true };
+    auto power_clipped = dvoronoi::power::algorithm::generate(sites, zero_weights, clipped);
+    auto sweep_clipped = algorithm::generate(sites, config);
+    algorithm::clip(*sweep_clipped, dvoronoi::convex_polygon_t::from_box(clipped.bounding_box.value()));
+
+    auto power_geometry = dvoronoi::compute_cell_geometry(*power_clipped);
+    auto sweep_geometry = dvoronoi::compute_cell_geometry(*sweep_clipped);
+    double max_difference = 0;
+    for (std::size_t i = 0; i < count; ++i)
+        max_difference = std::max(max_difference, std::fabs(power_geometry.area[i] - sweep_geometry.area[i]));
+    std::cout << std::setprecision(9) << "zero weights vs sweep, max cell area difference: " << max_difference << std::endl;
+}
@@ -0,0 +1,84 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/raster/rasterize.hpp>
+
+constexpr std::size_t width = 3840;
+constexpr std::size_t height = 2160;
+constexpr std::size_t count = 100000;
+constexpr int runs = 10;
+constexpr std::size_t samples = 2000;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+// pixels whose label isn't the nearest site of the pixel center, ties aside
+std::size_t check(const std::vector<point2d_t>& sites, const std::vector<dvoronoi::raster::label_t>& labels) {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<std::size_t> pixel(0, width * height - 1);
+
+    std::size_t mismatches = 0;
+    for (std::size_t s = 0; s < samples; ++s) {
+        auto p = pixel(rng);
+        auto x = static_cast<double>(p % width) + 0.5;
+        auto y = static_cast<double>(p / width) + 0.5;
+
+        auto dist = [&sites, x, y](std::size_t i) { return (sites[i].x - x) * (sites[i].x - x) + (sites[i].y - y) * (sites[i].y - y); };
+
+        std::size_t nearest = 0;
+        for (std::size_t i = 1; i < sites.size(); ++i) {
+            if (dist(i) < dist(nearest))
+                nearest = i;
+        }
+
+        if (labels[p] != nearest && dist(labels[p]) - dist(nearest) > 1e-9)
+            ++mismatches;
+    }
+
+    return mismatches;
+}
+
+int main() {
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * (width - 1.0), distrib(rng) * (height - 1.0));
+
+    const auto view = dvoronoi::box_t{ 0, 0, width, height };
+    auto diagram = dvoronoi::fortune::algorithm::generate(sites, dvoronoi::fortune::config_t{ view });
+
+    std::vector<dvoronoi::raster::label_t> labels(width * height);
+    const auto max_threads = dvoronoi::parallel::thread_count();
+
+    std::cout << count << " sites, " << width << 'x' << height << std::endl;
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        const auto config = dvoronoi::raster::raster_config_t{ view, width, height, dvoronoi::raster::no_label, threads };
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < runs; ++r)
+            dvoronoi::raster::rasterize(*diagram, labels, config);
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto ms = std::chrono::duration<double, std::milli>(end - start).count() / runs;
+        std::cout << std::fixed << std::setprecision(2)
+            << "[" << std::setw(2) << threads << " threads] " << ms << "ms, "
+            << static_cast<double>(width * height) / (ms * 1000.0) << " Mpixel/s" << std::endl;
+    }
+
+    std::cout << "mismatches: " << check(sites, labels) << " / " << samples << " sampled pixels" << std::endl;
+}
@@ -0,0 +1,167 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/common/cell_geometry.hpp>
+#include <dvoronoi/common/validate.hpp>
+#include <dvoronoi/common/reorder.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+double elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+double squared_distance(const dvoronoi::data::point_t& a, const dvoronoi::data::point_t& b) {
+    return (a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y);
+}
+
+// greedy walk over the neighbouring sites, towards the one nearest to the point
+std::size_t locate(const dvoronoi::voronoi_diagram_t& diag, const dvoronoi::data::point_t& p, std::size_t start, std::size_t& steps) {
+    const auto* face = &diag.faces[start];
+    auto distance = squared_distance(face->site->point, p);
+
+    for (bool moved = true; moved;) {
+        moved = false;
+        const auto* he = face->half_edge;
+        do {
+            if (he->twin != nullptr) {
+                const auto d = squared_distance(he->twin->face->site->point, p);
+                if (d < distance) {
+                    distance = d;
+                    face = he->twin->face;
+                    moved = true;
+                    ++steps;
+                    break;
+                }
+            }
+            he = he->next;
+        } while (he != face->half_edge);
+    }
+
+    return face->site->index;
+}
+
+struct walks_t {
+    double ms{};
+    std::size_t steps{};
+};
+
+// each walk starts where the previous one ended, the queries in random order so walks cross much of the diagram
+walks_t measure_walks(const dvoronoi::voronoi_diagram_t& diag, const std::vector<dvoronoi::data::point_t>& queries) {
+    walks_t walks;
+    std::size_t face = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& q : queries)
+        face = locate(diag, q, face, walks.steps);
+    walks.ms = elapsed_ms(start);
+
+    return walks;
+}
+
+struct lloyd_t {
+    double generate_ms{};
+    double centroids_ms{};
+};
+
+// iterations of generating, then moving every site to its cell's centroid
+lloyd_t measure_lloyd(std::vector<point2d_t> sites, std::size_t iterations) {
+    const dvoronoi::fortune::config_t config{ dvoronoi::box_t{ 0, 0, width, height } };
+
+    lloyd_t lloyd;
+    dvoronoi::cell_geometry_t geometry;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        auto diagram = dvoronoi::fortune::algorithm::generate(sites, config);
+        lloyd.generate_ms += elapsed_ms(start);
+
+        start = std::chrono::steady_clock::now();
+        dvoronoi::compute_cell_geometry(*diagram, geometry, 1);
+        lloyd.centroids_ms += elapsed_ms(start);
+
+        for (std::size_t k = 0; k < sites.size(); ++k) {
+            if (!std::isnan(geometry.centroid_x[k]))
+                sites[k] = point2d_t{ std::clamp(geometry.centroid_x[k], 0.0, width), std::clamp(geometry.centroid_y[k], 0.0, height) };
+        }
+    }
+
+    return lloyd;
+}
+
+// usage: benchmark_reorder [sites count] [lloyd iterations] [queries]
+// diagrams as generated from sites in random order, against renumbered along the Hilbert and Morton curves, after
+// generation and by permuting the sites up front, for Lloyd iterations and point location walks
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 200000;
+    const std::size_t iterations = argc > 2 ? std::stoull(argv[2]) : 5;
+    const std::size_t query_count = argc > 3 ? std::stoull(argv[3]) : 5000;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+    std::vector<dvoronoi::data::point_t> queries;
+    queries.reserve(query_count);
+    for (std::size_t i = 0; i < query_count; ++i)
+        queries.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+    const dvoronoi::fortune::config_t config{ dvoronoi::box_t{ 0, 0, width, height } };
+    std::cout << std::fixed << std::setprecision(3) << count << " sites, " << iterations << " Lloyd iterations, " << query_count << " queries" << std::endl;
+
+    // point location, on the diagram as generated and renumbered afterwards
+    const auto original = dvoronoi::fortune::algorithm::generate(sites, config);
+    const auto baseline = measure_walks(*original, queries);
+    std::cout << "[input order]   walks " << std::setw(10) << baseline.ms << "ms, " << baseline.steps << " steps" << std::endl;
+
+    for (const auto& [name, curve] : { std::pair{ "hilbert", dvoronoi::curve_t::hilbert }, std::pair{ "morton ", dvoronoi::curve_t::morton } }) {
+        auto diagram = std::make_unique<dvoronoi::voronoi_diagram_t>(*original);
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto mapping = dvoronoi::reorder(*diagram, curve);
+        const auto reorder_ms = elapsed_ms(start);
+
+        bool mapped = true;
+        for (std::size_t i = 0; i < count; ++i)
+            mapped = mapped && diagram->sites[i].point.x == original->sites[mapping[i]].point.x && diagram->sites[i].point.y == original->sites[mapping[i]].point.y;
+
+        const auto walks = measure_walks(*diagram, queries);
+        std::cout << "[" << name << "]       walks " << std::setw(10) << walks.ms << "ms (" << walks.ms / baseline.ms << "x), reorder " << reorder_ms
+                  << "ms, mapping " << (mapped ? "ok" : "WRONG") << ", " << dvoronoi::validate(*diagram) << std::endl;
+    }
+
+    // Lloyd, from sites in random order and from the same ones permuted up front, the order surviving the iterations
+    const auto lloyd = measure_lloyd(sites, iterations);
+    std::cout << "[input order]   Lloyd generate " << std::setw(10) << lloyd.generate_ms << "ms, centroids " << std::setw(10) << lloyd.centroids_ms << "ms" << std::endl;
+
+    for (const auto& [name, curve] : { std::pair{ "hilbert", dvoronoi::curve_t::hilbert }, std::pair{ "morton ", dvoronoi::curve_t::morton } }) {
+        std::vector<point2d_t> permuted;
+        permuted.reserve(count);
+        for (auto i : dvoronoi::spatial_order(sites, curve))
+            permuted.push_back(sites[i]);
+
+        const auto reordered = measure_lloyd(permuted, iterations);
+        std::cout << "[" << name << "]       Lloyd generate " << std::setw(10) << reordered.generate_ms << "ms (" << reordered.generate_ms / lloyd.generate_ms
+                  << "x), centroids " << std::setw(10) << reordered.centroids_ms << "ms (" << reordered.centroids_ms / lloyd.centroids_ms << "x)" << std::endl;
+    }
+}
@@ -0,0 +1,261 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_BENCHMARK_RESULTS_HPP
+#define DVORONOI_BENCHMARK_RESULTS_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+#include <thread>
+#include <fstream>
+#include <sstream>
+#include <ostream>
+#include <optional>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <sys/utsname.h>
+#endif
+
+// the revision the benchmarks were configured from, see benchmark/CMakeLists.txt
+#ifndef DVORONOI_REVISION
+#define DVORONOI_REVISION "unknown"
+#endif
+
+// machine readable benchmark results: one record per run and per phase, each carrying the revision and the host, in
+// CSV or in JSON with one record object per line
+namespace results {
+
+    struct host_t {
+        std::string revision{ DVORONOI_REVISION };
+        std::string hostname{ "unknown" };
+        std::string os{ "unknown" };
+        std::string cpu{ "unknown" };
+        std::string compiler{ "unknown" };
+        unsigned threads{ std::thread::hardware_concurrency() };
+
+        static host_t current() {
+            host_t host;
+#if defined(__unix__) || defined(__APPLE__)
+            char name[256] = {};
+            if (gethostname(name, sizeof(name) - 1) == 0)
+                host.hostname = name;
+
+            utsname uts{};
+            if (uname(&uts) == 0)
+                host.os = std::string(uts.sysname) + " " + uts.release + " " + uts.machine;
+#endif
+            // linux only, left unknown elsewhere
+            std::ifstream cpuinfo("/proc/cpuinfo");
+            for (std::string line; std::getline(cpuinfo, line);) {
+                if (line.rfind("model name", 0) == 0 && line.find(':') != std::string::npos) {
+                    host.cpu = line.substr(line.find(':') + 2);
+                    break;
+                }
+            }
+#if defined(__clang__)
+            host.compiler = "clang " __clang_version__;
+#elif defined(__GNUC__)
+            host.compiler = "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+            host.compiler = "msvc " + std::to_string(_MSC_VER);
+#endif
+            return host;
+        }
+    };
+
+    struct record_t {
+        std::string distribution;
+        std::size_t sites;
+        std::size_t run;
+        std::string phase;
+        double ns;
+    };
+
+    enum class format_t { text, csv, json };
+
+    inline std::optional<format_t> parse_format(const std::string& name) {
+        if (name == "text")
+            return format_t::text;
+        if (name == "csv")
+            return format_t::csv;
+        if (name == "json")
+            return format_t::json;
+        return std::nullopt;
+    }
+
+    namespace _details {
+        inline std::string csv_field(const std::string& s) {
+            if (s.find_first_of(",\"\n") == std::string::npos)
+                return s;
+
+            std::string quoted = "\"";
+            for (auto c : s) {
+                if (c == '"')
+                    quoted += '"';
+                quoted += c;
+            }
+            return quoted + "\"";
+        }
+
+        inline std::string json_string(const std::string& s) {
+            std::string quoted = "\"";
+            for (auto c : s) {
+                if (c == '"' || c == '\\')
+                    quoted += '\\';
+                if (c == '\n')
+                    quoted += "\\n";
+                else
+                    quoted += c;
+            }
+            return quoted + "\"";
+        }
+    } // namespace _details
+
+    class writer_t {
+    public:
+        writer_t(std::ostream& out, format_t format, host_t host = host_t::current()) : _out(out), _format(format), _host(std::move(host)) {
+            if (_format == format_t::csv)
+                _out << "revision,hostname,os,cpu,compiler,threads,distribution,sites,run,phase,ns,ns_per_site\n";
+            else if (_format == format_t::json)
+                _out << "[\n";
+        }
+
+        ~writer_t() {
+            if (_format == format_t::json)
+                _out << (_first ? "" : "\n") << "]\n";
+            _out.flush();
+        }
+
+        writer_t(const writer_t&) = delete;
+        writer_t& operator=(const writer_t&) = delete;
+
+        void write(const record_t& record) {
+            using namespace _details;
+            const auto ns_per_site = record.ns / static_cast<double>(record.sites);
+
+            std::ostringstream line;
+            line.precision(12);
+            if (_format == format_t::csv) {
+                line << csv_field(_host.revision) << ',' << csv_field(_host.hostname) << ',' << csv_field(_host.os) << ','
+                     << csv_field(_host.cpu) << ',' << csv_field(_host.compiler) << ',' << _host.threads << ','
+                     << csv_field(record.distribution) << ',' << record.sites << ',' << record.run << ',' << csv_field(record.phase) << ','
+                     << record.ns << ',' << ns_per_site << '\n';
+            } else if (_format == format_t::json) {
+                line << (_first ? "" : ",\n") << "{\"revision\": " << json_string(_host.revision) << ", \"hostname\": " << json_string(_host.hostname)
+                     << ", \"os\": " << json_string(_host.os) << ", \"cpu\": " << json_string(_host.cpu) << ", \"compiler\": " << json_string(_host.compiler)
+                     << ", \"threads\": " << _host.threads << ", \"distribution\": " << json_string(record.distribution) << ", \"sites\": " << record.sites
+                     << ", \"run\": " << record.run << ", \"phase\": " << json_string(record.phase) << ", \"ns\": " << record.ns
+                     << ", \"ns_per_site\": " << ns_per_site << "}";
+            }
+
+            _first = false;
+            _out << line.str();
+        }
+
+    private:
+        std::ostream& _out;
+        format_t _format;
+        host_t _host;
+        bool _first{true};
+    };
+
+    namespace _details {
+        inline std::vector<std::string> split_csv(const std::string& line) {
+            std::vector<std::string> fields(1);
+            bool quoted = false;
+            for (std::size_t i = 0; i < line.size(); ++i) {
+                auto c = line[i];
+                if (quoted) {
+                    if (c == '"' && i + 1 < line.size() && line[i + 1] == '"')
+                        fields.back() += line[++i];
+                    else if (c == '"')
+                        quoted = false;
+                    else
+                        fields.back() += c;
+                } else if (c == '"') {
+                    quoted = true;
+                } else if (c == ',') {
+                    fields.emplace_back();
+                } else if (c != '\r') {
+                    fields.back() += c;
+                }
+            }
+            return fields;
+        }
+
+        // the flat objects writer_t emits, one per line
+        inline std::map<std::string, std::string> split_json_object(const std::string& line) {
+            std::map<std::string, std::string> fields;
+            auto read_string = [&line](std::size_t& i) {
+                std::string s;
+                for (++i; i < line.size() && line[i] != '"'; ++i) {
+                    if (line[i] == '\\' && i + 1 < line.size()) {
+                        ++i;
+                        s += line[i] == 'n' ? '\n' : line[i];
+                    } else {
+                        s += line[i];
+                    }
+                }
+                ++i;
+                return s;
+            };
+
+            for (std::size_t i = line.find('{'); i < line.size();) {
+                i = line.find('"', i);
+                if (i == std::string::npos)
+                    break;
+                auto key = read_string(i);
+                i = line.find_first_not_of(" :", i);
+                if (i == std::string::npos)
+                    break;
+                if (line[i] == '"') {
+                    fields[key] = read_string(i);
+                } else {
+                    auto end = line.find_first_of(",}", i);
+                    fields[key] = line.substr(i, end - i);
+                    i = end;
+                }
+            }
+            return fields;
+        }
+    } // namespace _details
+
+    // reads either format back, by field name, so files from older or newer writers with other columns still load
+    inline std::optional<std::vector<std::map<std::string, std::string>>> read(const std::string& path) {
+        std::ifstream in(path);
+        if (!in)
+            return std::nullopt;
+
+        std::vector<std::map<std::string, std::string>> rows;
+        std::string line;
+        if (!std::getline(in, line))
+            return rows;
+
+        if (line.find_first_not_of(" \t") != std::string::npos && line[line.find_first_not_of(" \t")] == '[') {
+            while (std::getline(in, line)) {
+                if (line.find('{') != std::string::npos)
+                    rows.push_back(_details::split_json_object(line));
+            }
+            return rows;
+        }
+
+        const auto header = _details::split_csv(line);
+        while (std::getline(in, line)) {
+            if (line.empty())
+                continue;
+
+            const auto fields = _details::split_csv(line);
+            std::map<std::string, std::string> row;
+            for (std::size_t i = 0; i < header.size() && i < fields.size(); ++i)
+                row[header[i]] = fields[i];
+            rows.push_back(std::move(row));
+        }
+        return rows;
+    }
+
+} // namespace results
+
+#endif //DVORONOI_BENCHMARK_RESULTS_HPP
@@ -0,0 +1,99 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/common/validate.hpp>
+#include <dvoronoi/common/reorder.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr int runs = 10;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+double elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// twice the cells' areas summed, following next pointers
+double walk_rings(const dvoronoi::voronoi_diagram_t& diag) {
+    double sum = 0;
+    for (const auto& face : diag.faces) {
+        const auto* he = face.half_edge;
+        do {
+            sum += he->orig->point.det(he->dest->point);
+            he = he->next;
+        } while (he != face.half_edge);
+    }
+    return sum;
+}
+
+// the same, scanning the contiguous runs of a face major layout
+double scan_rings(const dvoronoi::voronoi_diagram_t& diag) {
+    double sum = 0;
+    for (const auto& face : diag.faces) {
+        for (const auto& he : dvoronoi::ring(diag, face))
+            sum += he.orig->point.det(he.dest->point);
+    }
+    return sum;
+}
+
+double measure(const auto& f, const dvoronoi::voronoi_diagram_t& diag, double& result) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < runs; ++r)
+        result = f(diag);
+    return elapsed_ms(start) / runs;
+}
+
+// usage: benchmark_rings [sites count]
+// ring traversals over the half edges in event order, as generated, and laid out face major, by pointers and by scans
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 200000;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+    const dvoronoi::box_t box{ 0, 0, width, height };
+    std::cout << std::fixed << std::setprecision(3) << count << " sites, averaged over " << runs << " runs" << std::endl;
+
+    dvoronoi::fortune::run_stats_t stats;
+    const auto generated = dvoronoi::fortune::algorithm::generate(sites, dvoronoi::fortune::config_t{ box }, stats);
+    const auto face_major = dvoronoi::fortune::algorithm::generate(sites, dvoronoi::fortune::config_t{ box, false, std::nullopt, true }, stats);
+    std::cout << "face major layout, while generating " << std::setw(10) << stats.milliseconds(dvoronoi::fortune::phase_t::layout) << "ms, "
+              << dvoronoi::validate(*face_major) << std::endl;
+
+    // after a curve renumbering as well, so the faces are neighbours too
+    auto reordered = std::make_unique<dvoronoi::voronoi_diagram_t>(*generated);
+    dvoronoi::reorder(*reordered);
+    dvoronoi::compact_rings(*reordered);
+
+    double walked = 0, walked_face_major = 0, scanned = 0, scanned_reordered = 0;
+    const auto walk_ms = measure(walk_rings, *generated, walked);
+    const auto walk_face_major_ms = measure(walk_rings, *face_major, walked_face_major);
+    const auto scan_ms = measure(scan_rings, *face_major, scanned);
+    const auto scan_reordered_ms = measure(scan_rings, *reordered, scanned_reordered);
+
+    std::cout << "[event order]  walk       " << std::setw(10) << walk_ms << "ms" << std::endl;
+    std::cout << "[face major]   walk       " << std::setw(10) << walk_face_major_ms << "ms (" << walk_face_major_ms / walk_ms << "x)" << std::endl;
+    std::cout << "[face major]   scan       " << std::setw(10) << scan_ms << "ms (" << scan_ms / walk_ms << "x)" << std::endl;
+    std::cout << "[hilbert, face major] scan" << std::setw(10) << scan_reordered_ms << "ms (" << scan_reordered_ms / walk_ms << "x)" << std::endl;
+    std::cout << "area sums agree: " << (std::abs(walked - scanned) <= 1e-9 * std::abs(walked) && std::abs(walked - walked_face_major) <= 1e-9 * std::abs(walked)
+                                         && std::abs(walked - scanned_reordered) <= 1e-9 * std::abs(walked) ? "yes" : "NO") << std::endl;
+}
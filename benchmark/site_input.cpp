@@ -0,0 +1,71 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <span>
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/common/site_views.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr int runs = 3;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+template<typename F>
+double measure(F&& f) {
+    double total = 0;
+    for (int r = 0; r < runs; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        auto diagram = f();
+        const auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    return total / runs;
+}
+
+// usage: benchmark_site_input [sites count]
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 1000000;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+
+    std::vector<point2d_t> points;
+    std::vector<double> xs, ys;
+    points.reserve(count);
+    xs.reserve(count);
+    ys.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        points.emplace_back(distrib(rng) * (width - 1.0), distrib(rng) * (height - 1.0));
+        xs.push_back(points.back().x);
+        ys.push_back(points.back().y);
+    }
+
+    const dvoronoi::fortune::config_t config{ dvoronoi::box_t{ -0.5, -0.5, width + 0.5, height + 0.5 } };
+    using dvoronoi::fortune::algorithm;
+
+    std::cout << std::fixed << std::setprecision(1) << count << " sites" << std::endl;
+
+    std::cout << "[vector of points]     " << measure([&]() { return algorithm::generate(points, config); }) << "ms" << std::endl;
+    std::cout << "[span of points]       " << measure([&]() { return algorithm::generate(std::span(points), config); }) << "ms" << std::endl;
+    std::cout << "[strided x/y arrays]   " << measure([&]() {
+        return algorithm::generate(dvoronoi::strided_sites_t<double>(xs.data(), ys.data(), count), config);
+    }) << "ms" << std::endl;
+    std::cout << "[strided struct array] " << measure([&]() {
+        return algorithm::generate(dvoronoi::strided_sites_t<double>(&points[0].x, &points[0].y, count, sizeof(point2d_t)), config);
+    }) << "ms" << std::endl;
+}
@@ -0,0 +1,81 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr int runs = 5;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+template<typename F>
+double measure(F&& f) {
+    double total = 0;
+    for (int r = 0; r < runs; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        auto diagram = f();
+        const auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    return total / runs;
+}
+
+// usage: benchmark_stats [sites count]
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100000;
+
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+    // bounded only, box clipping would dominate the timings
+    const dvoronoi::fortune::config_t config{ dvoronoi::box_t{ -0.5, -0.5, width + 0.5, height + 0.5 } };
+    using dvoronoi::fortune::algorithm;
+    using dvoronoi::fortune::phase_t;
+
+    dvoronoi::fortune::run_stats_t stats;
+    auto diagram = algorithm::generate(sites, config, stats);
+    auto delaunay = algorithm::generate_delaunay(diagram, stats);
+
+    std::cout << count << " sites" << std::endl;
+    std::cout << "site events:                " << stats.site_events << std::endl;
+    std::cout << "circle events:              " << stats.circle_events << ", invalidated " << stats.invalidated_circle_events << std::endl;
+    std::cout << "peak event queue:           " << stats.peak_event_queue << std::endl;
+    std::cout << "peak beach line:            " << stats.peak_beach_line << " arcs" << std::endl;
+    std::cout << "beach line rotations:       " << stats.rotations << std::endl;
+    std::cout << "vertices, half edges:       " << stats.vertices << ", " << stats.half_edges << std::endl;
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "queue build, sweep:         " << stats.milliseconds(phase_t::queue_build) << "ms, " << stats.milliseconds(phase_t::sweep) << "ms" << std::endl;
+    std::cout << "bound, clip, delaunay:      " << stats.milliseconds(phase_t::bound) << "ms, " << stats.milliseconds(phase_t::clip) << "ms, "
+              << stats.milliseconds(phase_t::delaunay) << "ms" << std::endl;
+
+    // the cost of the instrumentation, against the default build of the sweep
+    dvoronoi::fortune::workspace_t workspace;
+    dvoronoi::fortune::instrumented_workspace_t instrumented_workspace;
+    const auto plain_ms = measure([&]() { return algorithm::generate(sites, config, workspace); });
+    const auto instrumented_ms = measure([&]() {
+        dvoronoi::fortune::run_stats_t run_stats;
+        return algorithm::generate(sites, config, instrumented_workspace, run_stats);
+    });
+    std::cout << "[no stats]     " << plain_ms << "ms" << std::endl;
+    std::cout << "[run stats]    " << instrumented_ms << "ms (" << instrumented_ms / plain_ms << "x)" << std::endl;
+}
@@ -0,0 +1,194 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <cmath>
+#include <random>
+#include <ranges>
+#include <chrono>
+#include <string>
+#include <cstring>
+#include <optional>
+#include <vector>
+#include <numbers>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/common/validate.hpp>
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+// degenerate inputs, uniform as the control case
+std::vector<point2d_t> make_sites(const std::string& input, std::size_t count) {
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+
+    const auto side = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto t = static_cast<double>(i) / static_cast<double>(count);
+
+        if (input == "uniform")
+            sites.emplace_back(distrib(rng) * 1000, distrib(rng) * 1000);
+        else if (input == "grid") // every four neighbours cocircular
+            sites.emplace_back(static_cast<double>(i % side), static_cast<double>(i / side));
+        else if (input == "cocircular")
+            sites.emplace_back(500 + 500 * std::cos(2 * std::numbers::pi * t), 500 + 500 * std::sin(2 * std::numbers::pi * t));
+        else if (input == "horizontal") // a single top row, all handled as top sites
+            sites.emplace_back(1000 * t, 0);
+        else if (input == "vertical")
+            sites.emplace_back(0, 1000 * t);
+        else if (input == "diagonal")
+            sites.emplace_back(1000 * t, 1000 * t);
+        else if (input == "duplicates") // a tenth of the sites, each repeated ten times on average
+            sites.push_back(i < count / 10 + 1 ? point2d_t{ distrib(rng) * 1000, distrib(rng) * 1000 } : sites[rng() % (count / 10 + 1)]);
+        else if (input == "huge")
+            sites.emplace_back((distrib(rng) - 0.5) * 1e15, (distrib(rng) - 0.5) * 1e15);
+        else if (input == "offset") // far from the origin, little precision left for the spread
+            sites.emplace_back(1e9 + distrib(rng), 1e9 + distrib(rng));
+    }
+
+    return sites;
+}
+
+// the sites' extents, padded so degenerate ones still span an area
+dvoronoi::box_t extents(const std::vector<point2d_t>& sites, double padding) {
+    auto [min_x, max_x] = std::ranges::minmax(sites | std::views::transform(&point2d_t::x));
+    auto [min_y, max_y] = std::ranges::minmax(sites | std::views::transform(&point2d_t::y));
+    const auto margin = padding * std::max({ max_x - min_x, max_y - min_y, std::abs(min_x) * 1e-6, 1.0 });
+    return { min_x - margin, min_y - margin, max_x + margin, max_y + margin };
+}
+
+// trivially copyable, sent back from the child process running the case
+struct outcome_t {
+    double generate_ms{};
+    double validate_ms{};
+    dvoronoi::validation_t validation{};
+};
+
+outcome_t run_case(const std::vector<point2d_t>& sites, const std::string& mode) {
+    using dvoronoi::fortune::algorithm;
+
+    outcome_t outcome;
+    const auto bounds = extents(sites, 0.1);
+
+    // clipped to the middle of the sites, so the sides cut through cells
+    const auto width = bounds.right - bounds.left, height = bounds.top - bounds.bottom;
+    const auto inner = dvoronoi::box_t{ bounds.left + width * 0.25, bounds.bottom + height * 0.25, bounds.right - width * 0.25, bounds.top - height * 0.25 };
+
+    // clipping is timed along with the generation
+    const auto start = std::chrono::steady_clock::now();
+    auto config = dvoronoi::fortune::config_t{ bounds };
+    if (mode == "merge")
+        config.merge_tolerance = 0;
+
+    auto diagram = algorithm::generate(sites, config);
+    if (mode == "clip")
+        algorithm::clip(*diagram, inner);
+    else if (mode == "polygon clip")
+        algorithm::clip(*diagram, dvoronoi::convex_polygon_t::from_box(inner));
+    const auto generated = std::chrono::steady_clock::now();
+
+    outcome.validation = dvoronoi::validate(*diagram);
+    const auto validated = std::chrono::steady_clock::now();
+
+    outcome.generate_ms = std::chrono::duration<double, std::milli>(generated - start).count();
+    outcome.validate_ms = std::chrono::duration<double, std::milli>(validated - generated).count();
+    return outcome;
+}
+
+// runs the case in a child process where possible, so crashes and hangs are recorded as failures too
+std::optional<outcome_t> run_isolated(const std::vector<point2d_t>& sites, const std::string& mode, unsigned timeout, std::string& failure) {
+#if defined(__unix__) || defined(__APPLE__)
+    int fds[2];
+    if (pipe(fds) != 0) {
+        failure = "pipe failed";
+        return std::nullopt;
+    }
+
+    const auto pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        alarm(timeout);
+        const auto outcome = run_case(sites, mode);
+        const auto written = write(fds[1], &outcome, sizeof(outcome));
+        _exit(written == sizeof(outcome) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    outcome_t outcome;
+    const auto received = pid > 0 ? read(fds[0], &outcome, sizeof(outcome)) : -1;
+    close(fds[0]);
+
+    int status = 0;
+    if (pid > 0)
+        waitpid(pid, &status, 0);
+
+    if (received == sizeof(outcome))
+        return outcome;
+
+    if (pid < 0)
+        failure = "fork failed";
+    else if (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM)
+        failure = "timed out after " + std::to_string(timeout) + "s";
+    else if (WIFSIGNALED(status))
+        failure = std::string("crashed, ") + strsignal(WTERMSIG(status));
+    else
+        failure = "exited with " + std::to_string(WEXITSTATUS(status));
+    return std::nullopt;
+#else
+    return run_case(sites, mode);
+#endif
+}
+
+// usage: benchmark_stress [sites count, 2000] [timeout in seconds, 60]
+// runs degenerate inputs through generate with bounding, then box or polygon clipping, or with duplicates merged, and
+// validates every diagram; exits with 1 when any of them failed
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 2000;
+    const unsigned timeout = argc > 2 ? static_cast<unsigned>(std::stoul(argv[2])) : 60;
+
+    const std::vector<std::string> inputs{ "uniform", "grid", "cocircular", "horizontal", "vertical", "diagonal", "duplicates", "huge", "offset" };
+    const std::vector<std::string> modes{ "bound", "clip", "polygon clip", "merge" };
+
+    std::cout << count << " sites" << std::endl;
+    std::cout << std::left << std::setw(12) << "input" << std::setw(14) << "mode" << std::right << std::setw(12) << "generate ms" << std::setw(12) << "validate ms"
+              << "  result" << std::endl;
+
+    std::size_t failures = 0;
+    for (const auto& input : inputs) {
+        const auto sites = make_sites(input, count);
+
+        for (const auto& mode : modes) {
+            std::string failure;
+            const auto outcome = run_isolated(sites, mode, timeout, failure);
+
+            std::cout << std::left << std::setw(12) << input << std::setw(14) << mode << std::right << std::fixed << std::setprecision(3);
+            if (outcome.has_value()) {
+                std::cout << std::setw(12) << outcome->generate_ms << std::setw(12) << outcome->validate_ms << "  " << outcome->validation << std::endl;
+                failures += outcome->validation.valid() ? 0 : 1;
+            } else {
+                std::cout << std::setw(12) << "-" << std::setw(12) << "-" << "  " << failure << std::endl;
+                ++failures;
+            }
+        }
+    }
+
+    std::cout << failures << " of " << inputs.size() * modes.size() << " cases failed" << std::endl;
+    return failures > 0 ? 1 : 0;
+}
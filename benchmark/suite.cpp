@@ -0,0 +1,238 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <cmath>
+#include <array>
+#include <random>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <numeric>
+#include <iostream>
+#include <algorithm>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+
+#include "results.hpp"
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+// sites inside [0, width] x [0, height], the degenerate ones on purpose
+std::vector<point2d_t> make_sites(const std::string& distribution, std::size_t count, std::size_t seed) {
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> distrib;
+
+    if (distribution == "uniform" || distribution == "sorted") {
+        for (std::size_t i = 0; i < count; ++i)
+            sites.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+        // already in sweep order
+        if (distribution == "sorted")
+            std::ranges::sort(sites, [](const auto& a, const auto& b) { return b.y < a.y || (b.y == a.y && b.x < a.x); });
+    } else if (distribution == "clustered") {
+        const auto clusters = std::max<std::size_t>(1, static_cast<std::size_t>(std::sqrt(static_cast<double>(count)) / 4));
+        std::vector<point2d_t> centers;
+        for (std::size_t c = 0; c < clusters; ++c)
+            centers.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+        // redrawn rather than clamped, clamping would line sites up on the sides
+        std::normal_distribution<double> normal(0.0, height / (4.0 * std::sqrt(static_cast<double>(clusters))));
+        while (sites.size() < count) {
+            const auto& center = centers[rng() % clusters];
+            auto p = point2d_t{ center.x + normal(rng), center.y + normal(rng) };
+            if (p.x >= 0 && p.x <= width && p.y >= 0 && p.y <= height)
+                sites.push_back(p);
+        }
+    } else if (distribution == "grid") {
+        const auto columns = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(count) * width / height)));
+        const auto rows = (count + columns - 1) / columns;
+        for (std::size_t i = 0; i < count; ++i)
+            sites.emplace_back((static_cast<double>(i % columns) + 0.5) * width / static_cast<double>(columns),
+                               (static_cast<double>(i / columns) + 0.5) * height / static_cast<double>(rows));
+    } else if (distribution == "collinear") {
+        for (std::size_t i = 0; i < count; ++i) {
+            auto t = distrib(rng);
+            sites.emplace_back(t * width, t * height);
+        }
+    } else if (distribution == "duplicates") {
+        // every site repeated ten times on average
+        std::vector<point2d_t> distinct;
+        for (std::size_t i = 0; i < count / 10 + 1; ++i)
+            distinct.emplace_back(distrib(rng) * width, distrib(rng) * height);
+        for (std::size_t i = 0; i < count; ++i)
+            sites.push_back(distinct[rng() % distinct.size()]);
+    }
+
+    return sites;
+}
+
+// degenerate inputs can leave open cells, which clipping and the Delaunay conversion do not expect
+bool is_closed(const auto& diagram) {
+    for (const auto& face : diagram.faces) {
+        auto he = face.half_edge;
+        if (he == nullptr)
+            return false;
+
+        std::size_t steps = 0;
+        do {
+            if (he->next == nullptr || he->orig == nullptr || he->dest == nullptr || ++steps > diagram.half_edges.size())
+                return false;
+            he = he->next;
+        } while (he != face.half_edge);
+    }
+
+    return true;
+}
+
+struct stats_t {
+    std::vector<double> samples{};
+
+    void add(double ns_per_site) { samples.push_back(ns_per_site); }
+
+    [[nodiscard]] double mean() const { return std::reduce(samples.begin(), samples.end()) / static_cast<double>(samples.size()); }
+    [[nodiscard]] double stddev() const {
+        if (samples.size() < 2)
+            return 0;
+
+        const auto m = mean();
+        auto sum = 0.0;
+        for (auto s : samples)
+            sum += (s - m) * (s - m);
+        return std::sqrt(sum / static_cast<double>(samples.size() - 1));
+    }
+};
+
+double elapsed_ns(auto start, auto end) { return std::chrono::duration<double, std::nano>(end - start).count(); }
+
+// usage: benchmark_suite [max sites count, up to 10000000] [runs] [text|csv|json] [output file]
+// csv and json write one record per run and phase, to the output file if given, with the table still shown, or in
+// place of the table otherwise
+int main(int argc, char** argv) {
+    const std::size_t max_count = argc > 1 ? std::stoull(argv[1]) : 1000000;
+    const std::size_t max_runs = argc > 2 ? std::stoull(argv[2]) : 10;
+    const auto format = results::parse_format(argc > 3 ? argv[3] : "text");
+    if (!format.has_value()) {
+        std::cerr << "unknown format " << argv[3] << ", expected text, csv or json" << std::endl;
+        return 1;
+    }
+
+    std::ofstream file;
+    if (argc > 4) {
+        file.open(argv[4]);
+        if (!file) {
+            std::cerr << "cannot write " << argv[4] << std::endl;
+            return 1;
+        }
+    }
+
+    const bool table = format == results::format_t::text || file.is_open();
+    std::ostream discarded(nullptr);
+    std::ostream& out = table ? std::cout : discarded;
+    std::unique_ptr<results::writer_t> writer;
+    if (format != results::format_t::text)
+        writer = std::make_unique<results::writer_t>(file.is_open() ? static_cast<std::ostream&>(file) : std::cout, format.value());
+
+    const std::array<std::string, 6> distributions{ "uniform", "clustered", "grid", "collinear", "duplicates", "sorted" };
+    const std::array<std::string, 5> phases{ "sweep", "bound", "clip", "delaunay", "total" };
+
+    const auto box = dvoronoi::box_t{ -0.5, -0.5, width + 0.5, height + 0.5 };
+    const auto clip_polygon = dvoronoi::convex_polygon_t::from_box(dvoronoi::box_t{ 0, 0, width, height });
+    using dvoronoi::fortune::algorithm;
+
+    dvoronoi::fortune::workspace_t workspace;
+
+    out << "ns/site, mean +- standard deviation over the runs" << std::endl;
+    out << std::left << std::setw(12) << "sites" << std::setw(8) << "runs";
+    for (const auto& phase : phases)
+        out << std::setw(20) << phase;
+    out << std::endl;
+
+    for (const auto& distribution : distributions) {
+        out << "[" << distribution << "]" << std::endl;
+
+        for (std::size_t count = 1000; count <= max_count; count *= 10) {
+            // fewer runs for the large inputs, at least 3 for the deviation to mean something
+            const auto runs = std::max<std::size_t>(3, std::min<std::size_t>(max_runs, 1000000 / count));
+
+            std::array<stats_t, 5> stats;
+            std::size_t open = 0;
+
+            for (std::size_t run = 0; run < runs; ++run) {
+                auto sites = make_sites(distribution, count, run);
+                const auto n = static_cast<double>(count);
+
+                auto start = std::chrono::steady_clock::now();
+                auto diagram = algorithm::generate(sites, dvoronoi::fortune::config_t{}, workspace);
+                auto end = std::chrono::steady_clock::now();
+                const auto sweep_ns = elapsed_ns(start, end);
+
+                start = std::chrono::steady_clock::now();
+                algorithm::bound(*diagram, box, workspace);
+                end = std::chrono::steady_clock::now();
+                const auto bound_ns = elapsed_ns(start, end);
+
+                stats[0].add(sweep_ns / n);
+                stats[1].add(bound_ns / n);
+                if (writer) {
+                    writer->write({ distribution, count, run, phases[0], sweep_ns });
+                    writer->write({ distribution, count, run, phases[1], bound_ns });
+                }
+
+                if (!is_closed(*diagram)) {
+                    ++open;
+                    continue;
+                }
+
+                start = std::chrono::steady_clock::now();
+                auto delaunay = algorithm::generate_delaunay(diagram);
+                end = std::chrono::steady_clock::now();
+                delaunay.reset();
+                const auto delaunay_ns = elapsed_ns(start, end);
+
+                // in place, clipping comes last so the largest inputs need no copy of the diagram
+                start = std::chrono::steady_clock::now();
+                algorithm::clip(*diagram, clip_polygon);
+                end = std::chrono::steady_clock::now();
+                const auto clip_ns = elapsed_ns(start, end);
+
+                stats[2].add(clip_ns / n);
+                stats[3].add(delaunay_ns / n);
+                stats[4].add((sweep_ns + bound_ns + clip_ns + delaunay_ns) / n);
+                if (writer) {
+                    writer->write({ distribution, count, run, phases[2], clip_ns });
+                    writer->write({ distribution, count, run, phases[3], delaunay_ns });
+                    writer->write({ distribution, count, run, phases[4], sweep_ns + bound_ns + clip_ns + delaunay_ns });
+                }
+            }
+
+            out << std::setw(12) << count << std::setw(8) << runs;
+            for (const auto& phase_stats : stats) {
+                std::ostringstream cell;
+                if (phase_stats.samples.empty())
+                    cell << "-";
+                else
+                    cell << std::fixed << std::setprecision(1) << phase_stats.mean() << " +- " << phase_stats.stddev();
+                out << std::setw(20) << cell.str();
+            }
+            if (open > 0)
+                out << "open cells in " << open << " runs, not clipped nor triangulated";
+            out << std::endl;
+        }
+    }
+}
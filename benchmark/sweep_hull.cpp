@@ -0,0 +1,121 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/algorithm.hpp>
+#include <dvoronoi/sweep_hull/algorithm.hpp>
+#include <dvoronoi/common/cell_geometry.hpp>
+#include <dvoronoi/common/validate.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr int runs = 5;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+template<typename F>
+double measure(F&& f) {
+    double total = 0;
+    for (int r = 0; r < runs; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        auto result = f();
+        const auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    return total / runs;
+}
+
+// the backend is just a template argument
+template<typename algorithm_t>
+auto generate(const std::vector<point2d_t>& sites, const dvoronoi::fortune::config_t& config) {
+    return algorithm_t::generate(sites, config);
+}
+
+std::vector<point2d_t> make_sites(const std::string& distribution, std::size_t count) {
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> distrib;
+    if (distribution == "uniform") {
+        for (std::size_t i = 0; i < count; ++i)
+            sites.emplace_back(distrib(rng) * width, distrib(rng) * height);
+    } else {
+        const auto clusters = std::max<std::size_t>(1, static_cast<std::size_t>(std::sqrt(static_cast<double>(count)) / 4));
+        std::vector<point2d_t> centers;
+        for (std::size_t c = 0; c < clusters; ++c)
+            centers.emplace_back(distrib(rng) * width, distrib(rng) * height);
+
+        std::normal_distribution<double> normal(0.0, height / (4.0 * std::sqrt(static_cast<double>(clusters))));
+        while (sites.size() < count) {
+            const auto& center = centers[rng() % clusters];
+            auto p = point2d_t{ center.x + normal(rng), center.y + normal(rng) };
+            if (p.x >= 0 && p.x <= width && p.y >= 0 && p.y <= height)
+                sites.push_back(p);
+        }
+    }
+
+    return sites;
+}
+
+// usage: benchmark_sweep_hull [sites count]
+// the sweep hull backend against Fortune's: the triangulation against the sweep alone, then whole generate calls,
+// bounded and clipped, and the clipped diagrams compared by cell areas
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100000;
+
+    const dvoronoi::box_t box{ 0, 0, width, height };
+    const dvoronoi::fortune::config_t bounded{ box };
+    const dvoronoi::fortune::config_t clipped{ box, true };
+
+    std::cout << std::fixed << std::setprecision(3) << count << " sites, averaged over " << runs << " runs" << std::endl;
+
+    for (const std::string distribution : { "uniform", "clustered" }) {
+        const auto sites = make_sites(distribution, count);
+        std::cout << "[" << distribution << "]" << std::endl;
+
+        const auto sweep_ms = measure([&sites]() { return dvoronoi::fortune::algorithm::generate(sites); });
+        const auto triangulation_ms = measure([&sites, &box]() {
+            auto triangulation = std::make_unique<dvoronoi::sweep_hull::_details::delaunay_triangulation_t>();
+            triangulation->init(sites.size(), [&sites](std::size_t i) { return dvoronoi::data::point_t{ sites[i].x, sites[i].y }; }, box);
+            triangulation->build();
+            return triangulation;
+        });
+        std::cout << "  fortune sweep, unbounded   " << std::setw(10) << sweep_ms << "ms" << std::endl;
+        std::cout << "  sweep hull triangulation   " << std::setw(10) << triangulation_ms << "ms (" << triangulation_ms / sweep_ms << "x)" << std::endl;
+
+        for (const auto& [name, config] : { std::pair{ "bounded", bounded }, std::pair{ "clipped", clipped } }) {
+            const auto fortune_ms = measure([&sites, &config]() { return generate<dvoronoi::fortune::algorithm>(sites, config); });
+            const auto sweep_hull_ms = measure([&sites, &config]() { return generate<dvoronoi::sweep_hull::algorithm>(sites, config); });
+            std::cout << "  fortune, " << name << "          " << std::setw(10) << fortune_ms << "ms" << std::endl;
+            std::cout << "  sweep hull, " << name << "       " << std::setw(10) << sweep_hull_ms << "ms (" << sweep_hull_ms / fortune_ms << "x)" << std::endl;
+        }
+
+        // compared clipped, as bounding adds different corners, and by polygon clipping, the box clipper being quadratic
+        auto fortune_diagram = generate<dvoronoi::fortune::algorithm>(sites, bounded);
+        dvoronoi::fortune::algorithm::clip(*fortune_diagram, dvoronoi::convex_polygon_t::from_box(box));
+        auto sweep_hull_diagram = generate<dvoronoi::sweep_hull::algorithm>(sites, clipped);
+
+        const auto fortune_geometry = dvoronoi::compute_cell_geometry(*fortune_diagram);
+        const auto sweep_hull_geometry = dvoronoi::compute_cell_geometry(*sweep_hull_diagram);
+        double max_difference = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            max_difference = std::max(max_difference, std::abs(fortune_geometry.area[i] - sweep_hull_geometry.area[i]));
+
+        std::cout << "  largest cell area difference " << std::scientific << max_difference << std::fixed << std::endl;
+        std::cout << "  sweep hull diagram " << dvoronoi::validate(*sweep_hull_diagram) << std::endl;
+    }
+}
@@ -0,0 +1,77 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#include <random>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include <dvoronoi/fortune/tiling.hpp>
+
+constexpr double width = 3840;
+constexpr double height = 2160;
+constexpr std::size_t count = 100000;
+constexpr int runs = 5;
+
+template<typename T>
+struct gen_point2d_t {
+    T x = T(0), y = T(0);
+};
+
+typedef gen_point2d_t<double> point2d_t;
+
+auto generate_sites(std::size_t run) {
+    std::vector<point2d_t> sites;
+    sites.reserve(count);
+
+    std::mt19937 rng(run);
+    std::uniform_real_distribution<double> distrib;
+
+    for (std::size_t i = 0; i < count; ++i)
+        sites.emplace_back(distrib(rng) * (width - 1.0), distrib(rng) * (height - 1.0));
+
+    return sites;
+}
+
+template<typename F>
+auto measure(F&& f) {
+    const auto start = std::chrono::steady_clock::now();
+    auto result = f();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::make_pair(std::move(result), std::chrono::duration<double, std::milli>(end - start).count());
+}
+
+int main() {
+    const auto domain = dvoronoi::box_t{ -0.5, -0.5, width + 0.5, height + 0.5 };
+    const auto max_threads = dvoronoi::parallel::thread_count();
+
+    for (int r = 0; r < runs; ++r) {
+        auto sites = generate_sites(r);
+
+        auto [global, global_ms] = measure([&sites, &domain]() {
+            return dvoronoi::fortune::algorithm::generate(sites, dvoronoi::fortune::config_t{ domain, true });
+        });
+
+        std::cout << "run " << r << " [global] " << std::fixed << std::setprecision(1) << global_ms << "ms" << std::endl;
+
+        for (std::size_t tiles : { 2, 4, 8, 16 }) {
+            for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+                auto config = dvoronoi::fortune::tiling_config_t{ domain, tiles, tiles, 0, threads };
+
+                auto [stitched, tiled_ms] = measure([&sites, &config]() {
+                    return dvoronoi::fortune::tiling::generate(sites, config);
+                });
+
+                auto same = dvoronoi::fortune::tiling::same_cells(*global, *stitched);
+
+                std::cout
+                    << "run " << r << " [tiled " << std::setw(2) << tiles << 'x' << std::setw(2) << tiles
+                    << ", " << std::setw(2) << threads << " threads] " << tiled_ms << "ms"
+                    << ", speedup " << std::setprecision(2) << global_ms / tiled_ms << std::setprecision(1)
+                    << (same ? ", matches global" : ", MISMATCH") << std::endl;
+            }
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #include <random>
 #include <chrono>
 #include <numeric>
+#include <iomanip>
 #include <iostream>
 
 #include <dvoronoi/fortune/algorithm.hpp>
@@ -43,11 +44,11 @@ void bench(std::size_t sites_count) {
         auto run_duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
         durations.push_back(run_duration);
 
-        std::cout << "finished run " << std::setw(3) << r << " in " << run_duration << std::endl;
+        std::cout << "finished run " << std::setw(3) << r << " in " << run_duration.count() << "ms" << std::endl;
     }
 
     const auto avg_duration = std::reduce(durations.begin(), durations.end()) / float(durations.size());
-    std::cout << "avg: " << std::setw(3) <<  avg_duration << std::endl;
+    std::cout << "avg: " << std::setw(3) <<  avg_duration.count() << "ms" << std::endl;
 }
 
 int main() {
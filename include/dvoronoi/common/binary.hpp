@@ -0,0 +1,243 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_BINARY_HPP
+#define DVORONOI_BINARY_HPP
+
+#include <span>
+#include <array>
+#include <limits>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <filesystem>
+
+#include "diagram.hpp"
+#include "mapped_file.hpp"
+
+// Relocatable diagram format: a fixed header followed by four 64 byte aligned arrays of plain records,
+// every link is an index into one of the arrays, so a mapped file can be used as is.
+namespace dvoronoi::binary {
+
+    typedef std::uint32_t index_t;
+    constexpr index_t npos = std::numeric_limits<index_t>::max();
+
+    constexpr std::array<char, 8> magic = { 'D', 'V', 'O', 'R', 'O', 'N', 'O', 'I' };
+    constexpr std::uint32_t version = 1;
+    constexpr std::uint32_t endianness_tag = 0x01020304;
+    constexpr std::size_t alignment = 64;
+
+    struct site_record_t {
+        double x;
+        double y;
+    };
+
+    struct vertex_record_t {
+        double x;
+        double y;
+    };
+
+    struct half_edge_record_t {
+        index_t orig;
+        index_t dest;
+        index_t twin;
+        index_t face;
+        index_t prev;
+        index_t next;
+    };
+
+    struct face_record_t {
+        index_t site;
+        index_t half_edge;
+    };
+
+    struct header_t {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t endianness_tag;
+        std::uint64_t sites_count;
+        std::uint64_t vertices_count;
+        std::uint64_t half_edges_count;
+        std::uint64_t faces_count;
+        std::uint64_t sites_offset;
+        std::uint64_t vertices_offset;
+        std::uint64_t half_edges_offset;
+        std::uint64_t faces_offset;
+    };
+
+    namespace _details {
+        inline std::uint64_t align(std::uint64_t offset) {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+
+        inline index_t index_of(const auto* element, const auto& storage) {
+            return element == nullptr ? npos : static_cast<index_t>(element - storage.data());
+        }
+
+        // pads with zeros up to the section's offset, so the file is written sequentially
+        inline bool write_section(std::ofstream& out, std::uint64_t offset, const auto& records) {
+            constexpr std::array<char, alignment> zeros{};
+            auto position = static_cast<std::uint64_t>(out.tellp());
+            out.write(zeros.data(), static_cast<std::streamsize>(offset - position));
+            out.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(records[0])));
+            return out.good();
+        }
+
+        inline header_t make_header(std::uint64_t sites, std::uint64_t vertices, std::uint64_t half_edges, std::uint64_t faces) {
+            header_t header{ magic, version, endianness_tag, sites, vertices, half_edges, faces };
+
+            header.sites_offset = align(sizeof(header_t));
+            header.vertices_offset = align(header.sites_offset + sites * sizeof(site_record_t));
+            header.half_edges_offset = align(header.vertices_offset + vertices * sizeof(vertex_record_t));
+            header.faces_offset = align(header.half_edges_offset + half_edges * sizeof(half_edge_record_t));
+
+            return header;
+        }
+    }
+
+    // returns false if the diagram is too large for 32 bit indices or the file can't be written
+    bool write(const auto& diag, const std::filesystem::path& path) {
+        using _details::index_of;
+
+        if (diag.half_edges.size() >= npos || diag.vertices.size() >= npos || diag.sites.size() >= npos)
+            return false;
+
+        std::vector<site_record_t> sites;
+        sites.reserve(diag.sites.size());
+        for (const auto& site : diag.sites)
+            sites.push_back({ site.point.x, site.point.y });
+
+        std::vector<vertex_record_t> vertices;
+        vertices.reserve(diag.vertices.size());
+        for (const auto& vertex : diag.vertices)
+            vertices.push_back({ vertex.point.x, vertex.point.y });
+
+        std::vector<half_edge_record_t> half_edges;
+        half_edges.reserve(diag.half_edges.size());
+        for (const auto& he : diag.half_edges) {
+            half_edges.push_back({
+                index_of(he.orig, diag.vertices), index_of(he.dest, diag.vertices), index_of(he.twin, diag.half_edges),
+                index_of(he.face, diag.faces), index_of(he.prev, diag.half_edges), index_of(he.next, diag.half_edges)
+            });
+        }
+
+        std::vector<face_record_t> faces;
+        faces.reserve(diag.faces.size());
+        for (const auto& face : diag.faces)
+            faces.push_back({ index_of(face.site, diag.sites), index_of(face.half_edge, diag.half_edges) });
+
+        auto header = _details::make_header(sites.size(), vertices.size(), half_edges.size(), faces.size());
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        return _details::write_section(out, header.sites_offset, sites) &&
+               _details::write_section(out, header.vertices_offset, vertices) &&
+               _details::write_section(out, header.half_edges_offset, half_edges) &&
+               _details::write_section(out, header.faces_offset, faces);
+    }
+
+    // read-only, memory mapped diagram; opening only validates the header, the arrays are used in place
+    class mapped_diagram_t {
+    public:
+        static std::optional<mapped_diagram_t> open(const std::filesystem::path& path) {
+            auto file = mapped_file_t::open(path);
+            if (!file || !valid(*file))
+                return std::nullopt;
+
+            return mapped_diagram_t(std::move(*file));
+        }
+
+        [[nodiscard]] const header_t& header() const { return *reinterpret_cast<const header_t*>(_file.data()); }
+
+        [[nodiscard]] std::span<const site_record_t> sites() const { return section<site_record_t>(header().sites_offset, header().sites_count); }
+        [[nodiscard]] std::span<const vertex_record_t> vertices() const { return section<vertex_record_t>(header().vertices_offset, header().vertices_count); }
+        [[nodiscard]] std::span<const half_edge_record_t> half_edges() const { return section<half_edge_record_t>(header().half_edges_offset, header().half_edges_count); }
+        [[nodiscard]] std::span<const face_record_t> faces() const { return section<face_record_t>(header().faces_offset, header().faces_count); }
+
+        // calls fn(half_edge_index) for the ring of the given face
+        void for_each_half_edge(std::size_t face, auto&& fn) const {
+            const auto half_edges = this->half_edges();
+            const auto first = faces()[face].half_edge;
+            if (first == npos)
+                return;
+
+            auto he = first;
+            do {
+                fn(he);
+                he = half_edges[he].next;
+            } while (he != npos && he != first);
+        }
+
+    private:
+        explicit mapped_diagram_t(mapped_file_t&& file) : _file(std::move(file)) {}
+
+        template<typename T>
+        std::span<const T> section(std::uint64_t offset, std::uint64_t count) const {
+            return { reinterpret_cast<const T*>(_file.data() + offset), static_cast<std::size_t>(count) };
+        }
+
+        static bool valid(const mapped_file_t& file) {
+            if (file.size() < sizeof(header_t))
+                return false;
+
+            const auto& h = *reinterpret_cast<const header_t*>(file.data());
+            if (h.magic != magic || h.version != version || h.endianness_tag != endianness_tag)
+                return false;
+
+            auto expected = _details::make_header(h.sites_count, h.vertices_count, h.half_edges_count, h.faces_count);
+            return std::memcmp(&expected, &h, sizeof(header_t)) == 0 &&
+                   h.faces_offset + h.faces_count * sizeof(face_record_t) <= file.size();
+        }
+
+    private:
+        mapped_file_t _file;
+    };
+
+    // rebuilds a regular, mutable diagram from a mapped one
+    inline auto to_diagram(const mapped_diagram_t& mapped) {
+        auto diagram = std::make_unique<voronoi_diagram_t>(mapped.sites().size());
+        diagram->vertices.reserve(mapped.vertices().size());
+        diagram->half_edges.reserve(mapped.half_edges().size());
+
+        auto at = [](auto& storage, index_t i) { return i == npos ? nullptr : &storage[i]; };
+
+        for (std::size_t i = 0; i < mapped.sites().size(); ++i)
+            diagram->sites.emplace_back(i, mapped.sites()[i].x, mapped.sites()[i].y);
+        for (const auto& v : mapped.vertices())
+            diagram->create_vertex({ v.x, v.y });
+        for (const auto& face : mapped.faces())
+            diagram->faces.emplace_back(at(diagram->sites, face.site));
+
+        for (std::size_t i = 0; i < mapped.half_edges().size(); ++i)
+            diagram->half_edges.emplace_back().index = i;
+
+        for (std::size_t i = 0; i < mapped.half_edges().size(); ++i) {
+            const auto& record = mapped.half_edges()[i];
+            auto& he = diagram->half_edges[i];
+            he.orig = at(diagram->vertices, record.orig);
+            he.dest = at(diagram->vertices, record.dest);
+            he.twin = at(diagram->half_edges, record.twin);
+            he.face = at(diagram->faces, record.face);
+            he.prev = at(diagram->half_edges, record.prev);
+            he.next = at(diagram->half_edges, record.next);
+        }
+
+        for (std::size_t i = 0; i < mapped.faces().size(); ++i) {
+            diagram->faces[i].half_edge = at(diagram->half_edges, mapped.faces()[i].half_edge);
+            if (diagram->faces[i].site)
+                diagram->faces[i].site->face = &diagram->faces[i];
+        }
+
+        return diagram;
+    }
+
+} // namespace dvoronoi::binary
+
+#endif //DVORONOI_BINARY_HPP
@@ -0,0 +1,117 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_CELL_GEOMETRY_HPP
+#define DVORONOI_CELL_GEOMETRY_HPP
+
+#include <cmath>
+#include <vector>
+#include <limits>
+
+#include "data.hpp"
+#include "box.hpp"
+#include "parallel.hpp"
+
+namespace dvoronoi {
+
+    // per face area, centroid, perimeter and bounding box, one column per quantity, indexed like diag.faces;
+    // faces without a closed ring get NaN everywhere
+    struct cell_geometry_t {
+        std::vector<data::scalar_t> area{};
+        std::vector<data::scalar_t> centroid_x{};
+        std::vector<data::scalar_t> centroid_y{};
+        std::vector<data::scalar_t> perimeter{};
+        std::vector<data::scalar_t> min_x{};
+        std::vector<data::scalar_t> min_y{};
+        std::vector<data::scalar_t> max_x{};
+        std::vector<data::scalar_t> max_y{};
+
+        [[nodiscard]] std::size_t size() const { return area.size(); }
+
+        [[nodiscard]] data::point_t centroid(std::size_t i) const { return { centroid_x[i], centroid_y[i] }; }
+        [[nodiscard]] box_t bounding_box(std::size_t i) const { return { min_x[i], min_y[i], max_x[i], max_y[i] }; }
+
+        void resize(std::size_t n) {
+            for (auto* column : { &area, &centroid_x, &centroid_y, &perimeter, &min_x, &min_y, &max_x, &max_y })
+                column->resize(n);
+        }
+    };
+
+    // single walk of every ring, shoelace sums taken relative to the site to keep them well conditioned
+    void compute_cell_geometry(const auto& diag, cell_geometry_t& geometry, std::size_t threads = 0) {
+        const auto n = diag.faces.size();
+        geometry.resize(n);
+
+        parallel::parallel_for_chunks(n, [&diag, &geometry](std::size_t begin, std::size_t end) {
+            constexpr auto nan = std::numeric_limits<data::scalar_t>::quiet_NaN();
+
+            for (auto i = begin; i < end; ++i) {
+                const auto& face = diag.faces[i];
+
+                data::scalar_t area = 0, cx = 0, cy = 0, perimeter = 0;
+                auto min_x = std::numeric_limits<data::scalar_t>::infinity(), min_y = min_x;
+                auto max_x = -min_x, max_y = -min_x;
+                bool closed = face.half_edge != nullptr;
+
+                if (closed) {
+                    const auto origin = face.site->point;
+
+                    auto he = face.half_edge;
+                    do {
+                        if (he->orig == nullptr || he->dest == nullptr || he->next == nullptr) {
+                            closed = false;
+                            break;
+                        }
+
+                        auto x0 = he->orig->point.x - origin.x, y0 = he->orig->point.y - origin.y;
+                        auto x1 = he->dest->point.x - origin.x, y1 = he->dest->point.y - origin.y;
+                        auto det = x0 * y1 - x1 * y0;
+
+                        area += det;
+                        cx += (x0 + x1) * det;
+                        cy += (y0 + y1) * det;
+                        perimeter += std::sqrt((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0));
+
+                        min_x = std::min(min_x, he->orig->point.x);
+                        min_y = std::min(min_y, he->orig->point.y);
+                        max_x = std::max(max_x, he->orig->point.x);
+                        max_y = std::max(max_y, he->orig->point.y);
+
+                        he = he->next;
+                    } while (he != face.half_edge);
+
+                    if (closed && area != 0) {
+                        cx = origin.x + cx / (3 * area);
+                        cy = origin.y + cy / (3 * area);
+                    } else if (closed) {
+                        cx = (min_x + max_x) / 2;
+                        cy = (min_y + max_y) / 2;
+                    }
+                    area *= 0.5;
+                }
+
+                if (!closed)
+                    area = cx = cy = perimeter = min_x = min_y = max_x = max_y = nan;
+
+                geometry.area[i] = area;
+                geometry.centroid_x[i] = cx;
+                geometry.centroid_y[i] = cy;
+                geometry.perimeter[i] = perimeter;
+                geometry.min_x[i] = min_x;
+                geometry.min_y[i] = min_y;
+                geometry.max_x[i] = max_x;
+                geometry.max_y[i] = max_y;
+            }
+        }, threads);
+    }
+
+    inline auto compute_cell_geometry(const auto& diag, std::size_t threads = 0) -> cell_geometry_t {
+        cell_geometry_t geometry;
+        compute_cell_geometry(diag, geometry, threads);
+        return geometry;
+    }
+
+} // namespace dvoronoi
+
+#endif //DVORONOI_CELL_GEOMETRY_HPP
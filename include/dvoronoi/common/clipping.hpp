@@ -8,8 +8,11 @@
 #include <unordered_set>
 #include <unordered_map>
 #include <array>
+#include <cstdint>
 
 #include "dvoronoi/common/diagram.hpp"
+#include "dvoronoi/common/polygon.hpp"
+#include "dvoronoi/common/parallel.hpp"
 
 namespace dvoronoi::voronoi {
 
@@ -273,6 +276,260 @@ namespace dvoronoi::voronoi {
         return success;
     }
 
+    namespace _details {
+
+        enum class face_class_t : std::uint8_t { open, inside, outside, crossing };
+
+        // clipped half edge, vertex ids below the old vertex count are existing vertices, the others new points
+        struct clipped_half_edge_t {
+            std::size_t orig;
+            std::size_t dest;
+            data::half_edge_t* source; // nullptr for the edges running along the polygon
+        };
+
+        struct clipped_point_t {
+            data::point_t point;
+            std::size_t edge; // polygon edge the point lies on, or the corner's index
+        };
+
+        // the clipped end points of an edge, in the direction of its lower indexed half edge
+        struct clipped_edge_t {
+            bool kept;
+            std::size_t orig;
+            std::size_t dest;
+        };
+
+    } // namespace _details
+
+    // clips a bounded diagram to a convex polygon. Faces are first classified on their bounding boxes, so cells
+    // strictly inside or outside the polygon are kept or dropped as a whole and only the cells crossing the boundary
+    // are intersected. Everything else is done in linear passes over the arrays, which are compacted in place order.
+    // Faces left empty get a null half_edge, the new edges along the polygon have no twin.
+    bool clip(auto& diag, const convex_polygon_t& polygon, std::size_t threads = 0) {
+        using half_edge_t = data::half_edge_t;
+        using _details::face_class_t;
+        constexpr auto npos = std::numeric_limits<std::size_t>::max();
+
+        const auto faces_count = diag.faces.size();
+        const auto old_vertices_count = diag.vertices.size();
+        const auto old_half_edges_count = diag.half_edges.size();
+
+        auto face_index = [&diag](const auto* face) { return static_cast<std::size_t>(face - diag.faces.data()); };
+        auto vertex_index = [&diag](const auto* vertex) { return static_cast<std::size_t>(vertex - diag.vertices.data()); };
+        auto half_edge_index = [&diag](const auto* half_edge) { return static_cast<std::size_t>(half_edge - diag.half_edges.data()); };
+
+        // bounding boxes in one pass over the half edges, which follows the arrays instead of the rings
+        auto boxes = std::vector<box_t>(faces_count, box_t{
+            std::numeric_limits<data::scalar_t>::infinity(), std::numeric_limits<data::scalar_t>::infinity(),
+            -std::numeric_limits<data::scalar_t>::infinity(), -std::numeric_limits<data::scalar_t>::infinity() });
+        for (const auto& he : diag.half_edges) {
+            if (he.orig == nullptr || he.dest == nullptr || he.next == nullptr)
+                return false; // not bounded
+
+            auto& box = boxes[face_index(he.face)];
+            box.left = std::min(box.left, he.orig->point.x);
+            box.bottom = std::min(box.bottom, he.orig->point.y);
+            box.right = std::max(box.right, he.orig->point.x);
+            box.top = std::max(box.top, he.orig->point.y);
+        }
+
+        auto classes = std::vector<face_class_t>(faces_count);
+        parallel::parallel_for_chunks(faces_count, [&diag, &polygon, &boxes, &classes](std::size_t begin, std::size_t end) {
+            for (auto f = begin; f < end; ++f) {
+                if (diag.faces[f].half_edge == nullptr) {
+                    classes[f] = face_class_t::outside;
+                    continue;
+                }
+
+                auto where = polygon.classify(boxes[f]);
+                classes[f] = where > 0 ? face_class_t::inside : (where < 0 ? face_class_t::outside : face_class_t::crossing);
+            }
+        }, threads);
+
+        // intersect the boundary cells; end points are shared through the edge they lie on, so twins agree
+        auto new_points = std::vector<_details::clipped_point_t>{};
+        auto clipped_edges = std::unordered_map<std::size_t, _details::clipped_edge_t>{};
+        auto corners = std::vector<std::size_t>(polygon.size(), npos);
+        auto clipped = std::vector<_details::clipped_half_edge_t>{};
+        auto clipped_rings = std::vector<std::pair<std::size_t, std::size_t>>{}; // face, end of its ring in clipped
+        auto kept = std::vector<_details::clipped_half_edge_t>{};
+
+        auto new_point = [&new_points, old_vertices_count](const data::point_t& point, std::size_t edge) {
+            new_points.push_back({ point, edge });
+            return old_vertices_count + new_points.size() - 1;
+        };
+        auto point_of = [&diag, &new_points, old_vertices_count](std::size_t id) -> const data::point_t& {
+            return id < old_vertices_count ? diag.vertices[id].point : new_points[id - old_vertices_count].point;
+        };
+        auto edge_of = [&polygon, &new_points, &point_of, old_vertices_count](std::size_t id) {
+            return id < old_vertices_count ? polygon.nearest_edge(point_of(id)) : new_points[id - old_vertices_count].edge;
+        };
+        auto corner = [&polygon, &corners, &new_point](std::size_t i) {
+            if (corners[i] == npos)
+                corners[i] = new_point(polygon.vertices()[i], i);
+            return corners[i];
+        };
+
+        auto clip_edge = [&polygon, &clipped_edges, &new_point, &vertex_index, &half_edge_index](half_edge_t* he) {
+            auto* lower = (he->twin != nullptr && he->twin < he) ? he->twin : he;
+
+            auto [iter, inserted] = clipped_edges.try_emplace(half_edge_index(lower));
+            if (inserted) {
+                const auto& a = lower->orig->point;
+                const auto& b = lower->dest->point;
+                auto segment = polygon.clip(a, b);
+
+                auto& edge = iter->second;
+                edge.kept = segment.has_value();
+                if (edge.kept) {
+                    auto direction = b - a;
+                    edge.orig = segment->enter_edge == segment_clip_t::npos ? vertex_index(lower->orig) : new_point(a + segment->t0 * direction, segment->enter_edge);
+                    edge.dest = segment->exit_edge == segment_clip_t::npos ? vertex_index(lower->dest) : new_point(a + segment->t1 * direction, segment->exit_edge);
+                }
+            }
+
+            auto edge = iter->second;
+            if (lower != he)
+                std::swap(edge.orig, edge.dest);
+            return edge;
+        };
+
+        // walks the polygon counter-clockwise from the point where the ring leaves it to the point where it comes back
+        auto follow_boundary = [&polygon, &clipped, &point_of, &edge_of, &corner](std::size_t from, std::size_t to) {
+            auto edge = edge_of(from);
+            const auto last_edge = edge_of(to);
+
+            auto current = from;
+            if (edge != last_edge || polygon.along(edge, point_of(from)) > polygon.along(edge, point_of(to))) {
+                do {
+                    edge = (edge + 1) % polygon.size();
+                    auto next = corner(edge);
+                    clipped.push_back({ current, next, nullptr });
+                    current = next;
+                } while (edge != last_edge);
+            }
+            clipped.push_back({ current, to, nullptr });
+        };
+
+        for (std::size_t f = 0; f < faces_count; ++f) {
+            if (classes[f] != face_class_t::crossing)
+                continue;
+
+            const auto& face = diag.faces[f];
+
+            kept.clear();
+            auto he = face.half_edge;
+            do {
+                auto edge = clip_edge(he);
+                if (edge.kept)
+                    kept.push_back({ edge.orig, edge.dest, he });
+                he = he->next;
+            } while (he != face.half_edge);
+
+            if (kept.empty()) {
+                // either the cell is outside, or the whole polygon is inside the cell
+                if (!data::contains(face, polygon.vertices()[0]))
+                    continue;
+
+                for (std::size_t i = 0; i < polygon.size(); ++i)
+                    clipped.push_back({ corner(i), corner((i + 1) % polygon.size()), nullptr });
+            } else {
+                for (std::size_t i = 0; i < kept.size(); ++i) {
+                    clipped.push_back(kept[i]);
+
+                    const auto& next = kept[(i + 1) % kept.size()];
+                    if (kept[i].dest != next.orig)
+                        follow_boundary(kept[i].dest, next.orig);
+                }
+            }
+
+            clipped_rings.emplace_back(f, clipped.size());
+        }
+
+        // new indices: the half edges of the inside faces keep their relative order, the clipped rings follow
+        auto half_edge_map = std::vector<std::size_t>(old_half_edges_count, npos);
+        std::size_t half_edges_count = 0;
+        for (std::size_t i = 0; i < old_half_edges_count; ++i)
+            if (classes[face_index(diag.half_edges[i].face)] == face_class_t::inside)
+                half_edge_map[i] = half_edges_count++;
+        for (std::size_t i = 0; i < clipped.size(); ++i)
+            if (clipped[i].source != nullptr)
+                half_edge_map[half_edge_index(clipped[i].source)] = half_edges_count + i;
+
+        auto vertices = decltype(diag.vertices)(diag.vertices.get_allocator());
+        auto half_edges = decltype(diag.half_edges)(diag.half_edges.get_allocator());
+        vertices.reserve(std::max(diag.vertices.capacity(), old_vertices_count + new_points.size()));
+        half_edges.reserve(std::max(diag.half_edges.capacity(), half_edges_count + clipped.size()));
+
+        auto vertex_map = std::vector<std::size_t>(old_vertices_count + new_points.size(), npos);
+        auto map_vertex = [&vertices, &vertex_map, &point_of](std::size_t id) {
+            if (vertex_map[id] == npos) {
+                vertex_map[id] = vertices.size();
+                vertices.emplace_back(vertices.size(), point_of(id));
+            }
+            return &vertices[vertex_map[id]];
+        };
+        auto map_twin = [&half_edges, &half_edge_map, &half_edge_index](const half_edge_t* source) -> half_edge_t* {
+            if (source == nullptr || source->twin == nullptr || half_edge_map[half_edge_index(source->twin)] == npos)
+                return nullptr;
+            return &half_edges[half_edge_map[half_edge_index(source->twin)]];
+        };
+
+        half_edges.resize(half_edges_count + clipped.size());
+
+        for (std::size_t i = 0; i < old_half_edges_count; ++i) {
+            if (half_edge_map[i] == npos || half_edge_map[i] >= half_edges_count)
+                continue;
+
+            const auto& source = diag.half_edges[i];
+            auto& he = half_edges[half_edge_map[i]];
+            he.index = half_edge_map[i];
+            he.orig = map_vertex(vertex_index(source.orig));
+            he.dest = map_vertex(vertex_index(source.dest));
+            he.face = source.face;
+            he.next = &half_edges[half_edge_map[half_edge_index(source.next)]];
+            he.prev = &half_edges[half_edge_map[half_edge_index(source.prev)]];
+            he.twin = map_twin(&source);
+        }
+
+        std::size_t ring_begin = 0;
+        for (const auto& [f, ring_end] : clipped_rings) {
+            const auto size = ring_end - ring_begin;
+            for (std::size_t i = 0; i < size; ++i) {
+                const auto& source = clipped[ring_begin + i];
+                auto& he = half_edges[half_edges_count + ring_begin + i];
+                he.index = half_edges_count + ring_begin + i;
+                he.orig = map_vertex(source.orig);
+                he.dest = map_vertex(source.dest);
+                he.face = &diag.faces[f];
+                he.next = &half_edges[half_edges_count + ring_begin + (i + 1) % size];
+                he.prev = &half_edges[half_edges_count + ring_begin + (i + size - 1) % size];
+                he.twin = map_twin(source.source);
+            }
+
+            ring_begin = ring_end;
+        }
+
+        ring_begin = 0;
+        auto ring = clipped_rings.begin();
+        for (std::size_t f = 0; f < faces_count; ++f) {
+            auto& face = diag.faces[f];
+            if (classes[f] == face_class_t::inside)
+                face.half_edge = &half_edges[half_edge_map[half_edge_index(face.half_edge)]];
+            else if (ring != clipped_rings.end() && ring->first == f) {
+                face.half_edge = &half_edges[half_edges_count + ring_begin];
+                ring_begin = ring->second;
+                ++ring;
+            } else
+                face.half_edge = nullptr;
+        }
+
+        diag.vertices = std::move(vertices);
+        diag.half_edges = std::move(half_edges);
+
+        return true;
+    }
+
 }
 
 #endif //DVORONOI_CLIPPING_HPP
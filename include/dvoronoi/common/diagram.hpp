@@ -10,15 +10,11 @@
 #include <cassert>
 #include <algorithm>
 #include <memory>
+#include <memory_resource>
 
 #include "data.hpp"
 #include "box.hpp"
 
-//#define DIAG_USE_PMR
-#ifdef DIAG_USE_PMR
-#include "tracing_resource.hpp"
-#endif
-
 namespace dvoronoi {
     struct diag_traits {
         typedef data::scalar_t scalar_t;
@@ -42,35 +38,21 @@ namespace dvoronoi::voronoi {
         typedef diag_traits::half_edge_t half_edge_t;
         typedef std::vector<std::vector<std::size_t>> triangulation_t;
         typedef std::vector<std::size_t> convex_hull_t;
-
-#ifdef DIAG_USE_PMR
-    private:
-        //memory_management::tracing_resource _tracing_vert{"vert", std::pmr::null_memory_resource()};
-        std::unique_ptr<std::byte[]> _vert_buf;
-        std::pmr::monotonic_buffer_resource _vert_res;
-        //memory_management::tracing_resource _tracing_he{"he  ", std::pmr::null_memory_resource()};
-        std::unique_ptr<std::byte[]> _he_buf;
-        std::pmr::monotonic_buffer_resource _he_res;
-#endif
+        typedef std::vector<std::size_t> input_faces_t;
 
     public:
-        std::vector<site_t> sites{};
-        std::vector<face_t> faces{};
-#ifdef DIAG_USE_PMR
-        std::pmr::vector<vertex_t> vertices{&_vert_res}; // requires pointer stability, so no re-allocation allowed
-        std::pmr::vector<half_edge_t> half_edges{&_he_res}; // requires pointer stability, so no re-allocation allowed
-#else
-        std::vector<vertex_t> vertices{}; // requires pointer stability, so no re-allocation allowed
-        std::vector<half_edge_t> half_edges{}; // requires pointer stability, so no re-allocation allowed
-#endif
+        // the four arrays come from the resource given at construction; copies use the default one
+        std::pmr::vector<site_t> sites{};
+        std::pmr::vector<face_t> faces{};
+        std::pmr::vector<vertex_t> vertices{}; // requires pointer stability, so no re-allocation allowed
+        std::pmr::vector<half_edge_t> half_edges{}; // requires pointer stability, so no re-allocation allowed
         std::unique_ptr<triangulation_t> triangulation{};
         std::unique_ptr<convex_hull_t> convex_hull{};
+        // set when generate merged duplicate sites: the face of every input site, by input index
+        std::unique_ptr<input_faces_t> input_faces{};
 
-        explicit diagram_t(std::size_t n)
-#ifdef DIAG_USE_PMR
-            : _vert_buf(new std::byte[(2 * n + 10) * sizeof(vertex_t)]), _vert_res(&_vert_buf[0], (2 * n + 10) * sizeof(vertex_t), std::pmr::null_memory_resource()/*&_tracing_vert*/)
-            , _he_buf(new std::byte[6 * n * sizeof(half_edge_t)]), _he_res(&_he_buf[0], 6 * n * sizeof(half_edge_t), std::pmr::null_memory_resource()/*&_tracing_he*/)
-#endif
+        explicit diagram_t(std::size_t n, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : sites(resource), faces(resource), vertices(resource), half_edges(resource)
         {
             sites.reserve(n);
             faces.reserve(n);
@@ -78,6 +60,81 @@ namespace dvoronoi::voronoi {
             half_edges.reserve(6 * n);
         }
 
+        // bulk copies the arrays, keeping their capacity, then rebases every link in one linear pass
+        diagram_t(const diagram_t& other) : diagram_t(other.sites.capacity()) {
+            copy_from(other);
+        }
+
+        diagram_t& operator=(const diagram_t& other) {
+            if (this != &other) {
+                sites.clear();
+                faces.clear();
+                vertices.clear();
+                half_edges.clear();
+                copy_from(other);
+            }
+            return *this;
+        }
+
+        // vectors keep their buffers when moved, so all the links stay valid; only between diagrams sharing a resource
+        // when assigning, otherwise the arrays are copied and relinked
+        diagram_t(diagram_t&&) noexcept = default;
+        diagram_t& operator=(diagram_t&& other) {
+            if (this == &other)
+                return *this;
+            if (resource() != other.resource())
+                return *this = other;
+
+            sites = std::move(other.sites);
+            faces = std::move(other.faces);
+            vertices = std::move(other.vertices);
+            half_edges = std::move(other.half_edges);
+            triangulation = std::move(other.triangulation);
+            convex_hull = std::move(other.convex_hull);
+            input_faces = std::move(other.input_faces);
+            return *this;
+        }
+
+        [[nodiscard]] std::pmr::memory_resource* resource() const { return sites.get_allocator().resource(); }
+
+        // grow the storage, relinking everything pointing into it; the constructor's reservation suffices for inputs in
+        // general position, bounding degenerate ones can need more
+        void reserve_vertices(std::size_t count) {
+            if (count <= vertices.capacity())
+                return;
+
+            decltype(vertices) grown(vertices.get_allocator());
+            grown.reserve(count);
+            grown.assign(vertices.begin(), vertices.end());
+
+            for (auto& he : half_edges) {
+                he.orig = rebase(he.orig, vertices.data(), grown.data());
+                he.dest = rebase(he.dest, vertices.data(), grown.data());
+            }
+
+            vertices = std::move(grown);
+        }
+
+        void reserve_half_edges(std::size_t count) {
+            if (count <= half_edges.capacity())
+                return;
+
+            decltype(half_edges) grown(half_edges.get_allocator());
+            grown.reserve(count);
+            grown.assign(half_edges.begin(), half_edges.end());
+
+            for (auto& face : faces)
+                face.half_edge = rebase(face.half_edge, half_edges.data(), grown.data());
+
+            for (auto& he : grown) {
+                he.twin = rebase(he.twin, half_edges.data(), grown.data());
+                he.prev = rebase(he.prev, half_edges.data(), grown.data());
+                he.next = rebase(he.next, half_edges.data(), grown.data());
+            }
+
+            half_edges = std::move(grown);
+        }
+
         vertex_t* create_vertex(const data::point_t& point) {
             return create_vertex(point, vertices, vertices.size());
         }
@@ -182,6 +239,45 @@ namespace dvoronoi::voronoi {
             }
         }
 
+    private:
+        template<typename T>
+        static T* rebase(T* p, const T* old_base, T* new_base) {
+            return p == nullptr ? nullptr : new_base + (p - old_base);
+        }
+
+        void copy_from(const diagram_t& other) {
+            sites.reserve(other.sites.capacity());
+            faces.reserve(other.faces.capacity());
+            vertices.reserve(other.vertices.capacity());
+            half_edges.reserve(other.half_edges.capacity());
+
+            sites.assign(other.sites.begin(), other.sites.end());
+            faces.assign(other.faces.begin(), other.faces.end());
+            vertices.assign(other.vertices.begin(), other.vertices.end());
+            half_edges.assign(other.half_edges.begin(), other.half_edges.end());
+
+            for (auto& site : sites)
+                site.face = rebase(site.face, other.faces.data(), faces.data());
+
+            for (auto& face : faces) {
+                face.site = rebase(face.site, other.sites.data(), sites.data());
+                face.half_edge = rebase(face.half_edge, other.half_edges.data(), half_edges.data());
+            }
+
+            for (auto& he : half_edges) {
+                he.orig = rebase(he.orig, other.vertices.data(), vertices.data());
+                he.dest = rebase(he.dest, other.vertices.data(), vertices.data());
+                he.twin = rebase(he.twin, other.half_edges.data(), half_edges.data());
+                he.face = rebase(he.face, other.faces.data(), faces.data());
+                he.prev = rebase(he.prev, other.half_edges.data(), half_edges.data());
+                he.next = rebase(he.next, other.half_edges.data(), half_edges.data());
+            }
+
+            triangulation = other.triangulation ? std::make_unique<triangulation_t>(*other.triangulation) : nullptr;
+            convex_hull = other.convex_hull ? std::make_unique<convex_hull_t>(*other.convex_hull) : nullptr;
+            input_faces = other.input_faces ? std::make_unique<input_faces_t>(*other.input_faces) : nullptr;
+        }
+
     }; // class diagram_t
 
 } // namespace dvoronoi::voronoi
@@ -196,11 +292,12 @@ namespace dvoronoi::delaunay {
         typedef diag_traits::triangle_half_edge_t half_edge_t;
 
     public:
-        std::vector<triangle_t> triangles{};
-        std::vector<vertex_t> vertices{};
-        std::vector<half_edge_t> half_edges{};
+        std::pmr::vector<triangle_t> triangles{};
+        std::pmr::vector<vertex_t> vertices{};
+        std::pmr::vector<half_edge_t> half_edges{};
 
-        explicit diagram_t(std::size_t n) {
+        explicit diagram_t(std::size_t n, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : triangles(resource), vertices(resource), half_edges(resource) {
             triangles.reserve(2 * n);
             vertices.reserve(n);
             half_edges.reserve(6 * n);
@@ -0,0 +1,111 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_DUAL_HPP
+#define DVORONOI_DUAL_HPP
+
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+#include "data.hpp"
+#include "box.hpp"
+
+// Voronoi (or power) cells from the dual triangulation, shared by the backends that build the triangulation first
+namespace dvoronoi::_details {
+
+    // one vertex per triangle touching a real site, one half edge per (triangle, real corner): the half edge of
+    // site a dual to the edge a -> b runs from the power center across that edge to the triangle's own center.
+    // triangulation has triangles (v counter-clockwise, n[i] across the edge opposite v[i], alive), is_ghost(v),
+    // power_center(triangle) and index_of(triangle, v); its ghosts enclose every real site
+    void build_dual_cells(const auto& triangulation, auto& diagram) {
+        typedef std::remove_cvref_t<decltype(triangulation)> triangulation_t;
+        constexpr auto npos = std::numeric_limits<std::size_t>::max();
+        const auto& triangles = triangulation.triangles;
+
+        auto vertex_of = std::vector<std::size_t>(triangles.size(), npos);
+        auto first_half_edge = std::vector<std::size_t>(triangles.size(), npos);
+        std::size_t vertices_count = 0, half_edges_count = 0;
+
+        for (std::size_t t = 0; t < triangles.size(); ++t) {
+            const auto& tri = triangles[t];
+            if (!tri.alive)
+                continue;
+
+            auto real = static_cast<std::size_t>(std::ranges::count_if(tri.v, [&triangulation](std::uint32_t v) { return !triangulation.is_ghost(v); }));
+            if (real == 0)
+                continue;
+
+            vertex_of[t] = vertices_count++;
+            first_half_edge[t] = half_edges_count;
+            half_edges_count += real;
+        }
+
+        diagram.vertices.reserve(std::max(diagram.vertices.capacity(), vertices_count));
+        diagram.half_edges.reserve(std::max(diagram.half_edges.capacity(), half_edges_count));
+
+        for (std::size_t t = 0; t < triangles.size(); ++t)
+            if (vertex_of[t] != npos)
+                diagram.create_vertex(triangulation.power_center(triangles[t]));
+
+        // the half edges of a triangle's real corners are consecutive, in corner order
+        diagram.half_edges.resize(half_edges_count);
+        auto slot = [&triangulation, &triangles, &first_half_edge, &diagram](std::uint32_t t, std::uint32_t v) {
+            const auto& tri = triangles[t];
+            auto i = triangulation_t::index_of(tri, v);
+            auto offset = std::ranges::count_if(tri.v.begin(), tri.v.begin() + static_cast<std::ptrdiff_t>(i), [&triangulation](std::uint32_t u) {
+                return !triangulation.is_ghost(u);
+            });
+            return &diagram.half_edges[first_half_edge[t] + static_cast<std::size_t>(offset)];
+        };
+
+        for (std::uint32_t t = 0; t < triangles.size(); ++t) {
+            if (vertex_of[t] == npos)
+                continue;
+
+            const auto& tri = triangles[t];
+            auto index = first_half_edge[t];
+            for (std::size_t i = 0; i < 3; ++i) {
+                const auto a = tri.v[i];
+                const auto b = tri.v[(i + 1) % 3];
+                if (triangulation.is_ghost(a))
+                    continue;
+
+                const auto across_ab = tri.n[(i + 2) % 3];
+                const auto across_ca = tri.n[(i + 1) % 3];
+
+                auto& he = diagram.half_edges[index];
+                he.index = index++;
+                he.orig = &diagram.vertices[vertex_of[across_ab]];
+                he.dest = &diagram.vertices[vertex_of[t]];
+                he.face = &diagram.faces[a];
+                he.next = slot(across_ca, a);
+                he.prev = slot(across_ab, a);
+                he.twin = triangulation.is_ghost(b) ? nullptr : slot(across_ab, b);
+                diagram.faces[a].half_edge = &he;
+            }
+        }
+    }
+
+    // the box grown over the power vertices of the triangles made of real sites only
+    box_t enclose_dual_vertices(const auto& triangulation, box_t box) {
+        for (const auto& tri : triangulation.triangles) {
+            if (!tri.alive || std::ranges::any_of(tri.v, [&triangulation](std::uint32_t v) { return triangulation.is_ghost(v); }))
+                continue;
+
+            auto center = triangulation.power_center(tri);
+            box.left = std::min(box.left, center.x);
+            box.bottom = std::min(box.bottom, center.y);
+            box.right = std::max(box.right, center.x);
+            box.top = std::max(box.top, center.y);
+        }
+
+        return box;
+    }
+
+} // namespace dvoronoi::_details
+
+#endif //DVORONOI_DUAL_HPP
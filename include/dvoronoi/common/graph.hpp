@@ -0,0 +1,238 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_GRAPH_HPP
+#define DVORONOI_GRAPH_HPP
+
+#include <span>
+#include <mutex>
+#include <limits>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+
+#include "data.hpp"
+#include "merge.hpp"
+#include "reorder.hpp"
+#include "parallel.hpp"
+
+namespace dvoronoi {
+
+    // an edge between the sites a < b, by site index
+    struct graph_edge_t {
+        std::size_t a{0}, b{0};
+        data::scalar_t length{0};
+    };
+
+    // neighbours by site, those of site i in neighbours[offsets[i], offsets[i + 1])
+    struct adjacency_t {
+        std::vector<std::size_t> offsets{};
+        std::vector<std::size_t> neighbours{};
+
+        [[nodiscard]] std::size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+        [[nodiscard]] std::span<const std::size_t> of(std::size_t i) const { return { neighbours.data() + offsets[i], neighbours.data() + offsets[i + 1] }; }
+    };
+
+    constexpr std::size_t no_neighbour = std::numeric_limits<std::size_t>::max();
+
+    // every site's k nearest other sites, nearest first, those of site i in neighbours[i * k, (i + 1) * k); slots
+    // left over when fewer are reachable hold no_neighbour
+    struct knn_graph_t {
+        std::size_t k{0};
+        std::vector<std::size_t> neighbours{};
+
+        [[nodiscard]] std::size_t size() const { return k == 0 ? 0 : neighbours.size() / k; }
+        [[nodiscard]] std::span<const std::size_t> of(std::size_t i) const { return { neighbours.data() + i * k, k }; }
+    };
+
+    // the Delaunay edges, one per pair of faces sharing a Voronoi edge, ordered by (a, b): the half edges are scanned in
+    // parallel, each pair taken from the half edge whose face has the lower site index, then bucketed by a. Clipping
+    // drops the adjacency of cells meeting only outside the clip, so the graphs below are complete on unclipped
+    // diagrams only
+    auto delaunay_edges(const auto& diag, std::size_t threads = 0) -> std::vector<graph_edge_t> {
+        const auto n = diag.faces.size();
+
+        std::vector<graph_edge_t> found;
+        std::mutex merge;
+
+        parallel::parallel_for_chunks(diag.half_edges.size(), [&](std::size_t begin, std::size_t end) {
+            std::vector<graph_edge_t> local;
+            for (auto i = begin; i < end; ++i) {
+                const auto& he = diag.half_edges[i];
+                if (he.twin == nullptr || he.face == nullptr || he.twin->face == nullptr)
+                    continue;
+
+                const auto& s1 = *he.face->site;
+                const auto& s2 = *he.twin->face->site;
+                if (s1.index < s2.index)
+                    local.push_back({ s1.index, s2.index, s1.point.dist(s2.point) });
+            }
+
+            std::scoped_lock lock(merge);
+            found.insert(found.end(), local.begin(), local.end());
+        }, threads, 4096);
+
+        // the chunks finish in any order; a counting pass by a, then every site's few edges sorted by b
+        std::vector<std::size_t> offsets(n + 1, 0);
+        for (const auto& e : found)
+            ++offsets[e.a + 1];
+        for (std::size_t i = 0; i < n; ++i)
+            offsets[i + 1] += offsets[i];
+
+        std::vector<graph_edge_t> edges(found.size());
+        {
+            auto fill = offsets;
+            for (const auto& e : found)
+                edges[fill[e.a]++] = e;
+        }
+
+        // a pair of clipped cells may share more than one edge
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto first = edges.begin() + static_cast<std::ptrdiff_t>(offsets[i]), last = edges.begin() + static_cast<std::ptrdiff_t>(offsets[i + 1]);
+            std::sort(first, last, [](const graph_edge_t& e1, const graph_edge_t& e2) { return e1.b < e2.b; });
+            for (auto e = first; e != last; ++e) {
+                if (e == first || e->b != (e - 1)->b)
+                    edges[kept++] = *e;
+            }
+        }
+        edges.resize(kept);
+
+        return edges;
+    }
+
+    // both directions of every edge, grouped by site
+    auto delaunay_adjacency(const auto& diag, std::size_t threads = 0) -> adjacency_t {
+        const auto n = diag.sites.size();
+        const auto edges = delaunay_edges(diag, threads);
+
+        adjacency_t adjacency;
+        adjacency.offsets.assign(n + 1, 0);
+        for (const auto& e : edges) {
+            ++adjacency.offsets[e.a + 1];
+            ++adjacency.offsets[e.b + 1];
+        }
+        for (std::size_t i = 0; i < n; ++i)
+            adjacency.offsets[i + 1] += adjacency.offsets[i];
+
+        auto fill = adjacency.offsets;
+        adjacency.neighbours.resize(2 * edges.size());
+        for (const auto& e : edges) {
+            adjacency.neighbours[fill[e.a]++] = e.b;
+            adjacency.neighbours[fill[e.b]++] = e.a;
+        }
+
+        return adjacency;
+    }
+
+    // the Euclidean minimum spanning tree is a subgraph of the Delaunay triangulation, so Kruskal's scan runs over its
+    // edges only, O(n) of them; the edges are sorted by length in parallel, the scan itself is a union-find pass and
+    // stops at the (n - 1)th tree edge. A diagram whose adjacency isn't connected gives a forest
+    auto minimum_spanning_tree(const auto& diag, std::size_t threads = 0) -> std::vector<graph_edge_t> {
+        const auto n = diag.sites.size();
+        auto edges = delaunay_edges(diag, threads);
+
+        // ties broken by index, so the tree doesn't depend on the sort
+        parallel::parallel_sort(edges.begin(), edges.end(), [](const graph_edge_t& e1, const graph_edge_t& e2) {
+            return std::tie(e1.length, e1.a, e1.b) < std::tie(e2.length, e2.a, e2.b);
+        }, threads);
+
+        std::vector<graph_edge_t> tree;
+        tree.reserve(n > 0 ? n - 1 : 0);
+
+        _details::site_groups_t groups(n);
+        for (const auto& e : edges) {
+            if (tree.size() + 1 >= n)
+                break;
+            if (groups.find(e.a) == groups.find(e.b))
+                continue;
+
+            groups.unite(e.a, e.b);
+            tree.push_back(e);
+        }
+
+        return tree;
+    }
+
+    // the ith nearest neighbour of a site is a Delaunay neighbour of the site or of one of its i - 1 nearer ones, so a
+    // best first search from every site, expanding the nearest site not yet taken, finds the k nearest after taking k
+    // sites and looking at their neighbours only. Sites are searched in parallel; ties are broken by index
+    auto nearest_neighbours(const auto& diag, std::size_t k, std::size_t threads = 0) -> knn_graph_t {
+        const auto n = diag.sites.size();
+
+        knn_graph_t graph;
+        graph.k = k;
+        graph.neighbours.assign(n * k, no_neighbour);
+        if (n < 2 || k == 0)
+            return graph;
+
+        const auto adjacency = delaunay_adjacency(diag, threads);
+
+        // the search runs over the sites renumbered along a Hilbert curve, so consecutive searches, and the sites each
+        // one reaches, sit close together in memory
+        std::vector<data::point_t> points(n);
+        for (const auto& site : diag.sites)
+            points[site.index] = site.point;
+        const auto order = spatial_order(points, curve_t::hilbert, threads);
+
+        std::vector<std::size_t> rank(n);
+        for (std::size_t r = 0; r < n; ++r)
+            rank[order[r]] = r;
+
+        adjacency_t local;
+        local.offsets.resize(n + 1);
+        local.neighbours.resize(adjacency.neighbours.size());
+        std::vector<data::point_t> local_points(n);
+        for (std::size_t r = 0; r < n; ++r) {
+            local_points[r] = points[order[r]];
+            local.offsets[r + 1] = local.offsets[r] + adjacency.of(order[r]).size();
+        }
+        parallel::parallel_for_chunks(n, [&](std::size_t begin, std::size_t end) {
+            for (auto r = begin; r < end; ++r)
+                std::ranges::transform(adjacency.of(order[r]), local.neighbours.begin() + static_cast<std::ptrdiff_t>(local.offsets[r]), [&rank](std::size_t j) { return rank[j]; });
+        }, threads);
+
+        parallel::parallel_for_chunks(n, [&](std::size_t begin, std::size_t end) {
+            // seen[j] == r when site j was reached by the search from site r
+            std::vector<std::size_t> seen(n, no_neighbour);
+            std::vector<std::pair<data::scalar_t, std::size_t>> frontier;
+
+            for (auto r = begin; r < end; ++r) {
+                const auto origin = local_points[r];
+                auto reach = [&](std::size_t site) {
+                    for (auto j : local.of(site)) {
+                        if (seen[j] == r)
+                            continue;
+
+                        seen[j] = r;
+                        const auto dx = local_points[j].x - origin.x, dy = local_points[j].y - origin.y;
+                        frontier.emplace_back(dx * dx + dy * dy, order[j]);
+                    }
+                };
+
+                frontier.clear();
+                seen[r] = r;
+                reach(r);
+
+                const auto i = order[r];
+                for (std::size_t taken = 0; taken < k && !frontier.empty(); ++taken) {
+                    const auto nearest = std::min_element(frontier.begin(), frontier.end());
+                    const auto next = nearest->second;
+                    *nearest = frontier.back();
+                    frontier.pop_back();
+
+                    graph.neighbours[i * k + taken] = next;
+                    if (taken + 1 < k)
+                        reach(rank[next]);
+                }
+            }
+        }, threads, 1024);
+
+        return graph;
+    }
+
+} // namespace dvoronoi
+
+#endif //DVORONOI_GRAPH_HPP
@@ -0,0 +1,134 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_MAPPED_FILE_HPP
+#define DVORONOI_MAPPED_FILE_HPP
+
+#include <span>
+#include <cstddef>
+#include <utility>
+#include <optional>
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace dvoronoi {
+
+    // read-only memory mapping of a whole file, mmap on posix and MapViewOfFile on Windows
+    class mapped_file_t {
+    public:
+        mapped_file_t(const mapped_file_t&) = delete;
+        mapped_file_t& operator=(const mapped_file_t&) = delete;
+
+        mapped_file_t(mapped_file_t&& other) noexcept { *this = std::move(other); }
+        mapped_file_t& operator=(mapped_file_t&& other) noexcept {
+            std::swap(_data, other._data);
+            std::swap(_size, other._size);
+#ifdef _WIN32
+            std::swap(_file, other._file);
+            std::swap(_mapping, other._mapping);
+#endif
+            return *this;
+        }
+
+        ~mapped_file_t() { unmap(); }
+
+        // empty files can't be mapped, so they are reported like missing ones
+        static std::optional<mapped_file_t> open(const std::filesystem::path& path) {
+            mapped_file_t file;
+            if (!file.map(path))
+                return std::nullopt;
+
+            return file;
+        }
+
+        [[nodiscard]] const std::byte* data() const { return _data; }
+        [[nodiscard]] std::size_t size() const { return _size; }
+        [[nodiscard]] std::span<const std::byte> bytes() const { return { _data, _size }; }
+
+    private:
+        mapped_file_t() = default;
+
+        bool map(const std::filesystem::path& path) {
+#ifdef _WIN32
+            _file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (_file == INVALID_HANDLE_VALUE)
+                return false;
+
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(_file, &size) || size.QuadPart == 0)
+                return false;
+
+            _mapping = CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (_mapping == nullptr)
+                return false;
+
+            _data = static_cast<const std::byte*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+            if (_data == nullptr)
+                return false;
+
+            _size = static_cast<std::size_t>(size.QuadPart);
+            return true;
+#else
+            auto fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+                return false;
+
+            struct stat st{};
+            if (fstat(fd, &st) != 0 || st.st_size == 0) {
+                ::close(fd);
+                return false;
+            }
+
+            auto addr = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (addr == MAP_FAILED)
+                return false;
+
+            _data = static_cast<const std::byte*>(addr);
+            _size = static_cast<std::size_t>(st.st_size);
+            return true;
+#endif
+        }
+
+        void unmap() {
+#ifdef _WIN32
+            if (_data != nullptr)
+                UnmapViewOfFile(_data);
+            if (_mapping != nullptr)
+                CloseHandle(_mapping);
+            if (_file != INVALID_HANDLE_VALUE)
+                CloseHandle(_file);
+            _mapping = nullptr;
+            _file = INVALID_HANDLE_VALUE;
+#else
+            if (_data != nullptr)
+                munmap(const_cast<std::byte*>(_data), _size);
+#endif
+            _data = nullptr;
+            _size = 0;
+        }
+
+    private:
+        const std::byte* _data = nullptr;
+        std::size_t _size = 0;
+#ifdef _WIN32
+        HANDLE _file = INVALID_HANDLE_VALUE;
+        HANDLE _mapping = nullptr;
+#endif
+    };
+
+} // namespace dvoronoi
+
+#endif //DVORONOI_MAPPED_FILE_HPP
@@ -0,0 +1,191 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_MERGE_HPP
+#define DVORONOI_MERGE_HPP
+
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <tuple>
+#include <functional>
+#include <algorithm>
+
+#include "data.hpp"
+#include "parallel.hpp"
+
+namespace dvoronoi {
+
+    // the sites left after merging, and where every input went
+    struct merged_sites_t {
+        std::vector<data::point_t> points{};       // one per group, its first input, in input order
+        std::vector<std::size_t> representative{}; // by input index, the index of its group's point
+
+        [[nodiscard]] bool merged() const { return points.size() < representative.size(); }
+    };
+
+    namespace _details {
+
+        // union by smallest index, so a root is the first input of its group
+        class site_groups_t {
+        public:
+            explicit site_groups_t(std::size_t n) : _parent(n) {
+                std::iota(_parent.begin(), _parent.end(), 0);
+            }
+
+            std::size_t find(std::size_t i) {
+                while (_parent[i] != i) {
+                    _parent[i] = _parent[_parent[i]];
+                    i = _parent[i];
+                }
+                return i;
+            }
+
+            void unite(std::size_t a, std::size_t b) {
+                a = find(a);
+                b = find(b);
+                if (a != b)
+                    _parent[std::max(a, b)] = std::min(a, b);
+            }
+
+        private:
+            std::vector<std::size_t> _parent;
+        };
+
+        // cells as wide as the tolerance, clamped so far away sites share the outermost ones rather than overflow
+        inline std::int64_t grid_cell(data::scalar_t offset, data::scalar_t tolerance) {
+            constexpr auto limit = static_cast<data::scalar_t>(std::int64_t{1} << 52);
+            return static_cast<std::int64_t>(std::clamp(std::floor(offset / tolerance), -limit, limit));
+        }
+
+    } // namespace _details
+
+    // groups sites closer than tolerance to one another, transitively, so a chain of sites each within tolerance of the
+    // next is one group; tolerance 0 groups exact duplicates only. The sites are sorted by grid cells tolerance wide, so
+    // only those in the same and the neighbouring cells are compared; the sort and the comparisons run in parallel
+    auto merge_sites(const auto& sites, data::scalar_t tolerance = 0, std::size_t threads = 0) -> merged_sites_t {
+        const auto n = sites.size();
+
+        std::vector<data::point_t> points(n);
+        parallel::parallel_for_chunks(n, [&points, &sites](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; ++i)
+                points[i] = { static_cast<data::scalar_t>(sites[i].x), static_cast<data::scalar_t>(sites[i].y) };
+        }, threads);
+
+        _details::site_groups_t groups(n);
+
+        if (tolerance <= 0) {
+            // equal sites end up next to one another; sorting the coordinates themselves rather than indices to them
+            std::vector<std::tuple<data::scalar_t, data::scalar_t, std::size_t>> keys(n);
+            parallel::parallel_for_chunks(n, [&keys, &points](std::size_t begin, std::size_t end) {
+                for (auto i = begin; i < end; ++i)
+                    keys[i] = { points[i].x, points[i].y, i };
+            }, threads);
+            parallel::parallel_sort(keys.begin(), keys.end(), std::less<>{}, threads);
+
+            for (std::size_t k = 1; k < n; ++k) {
+                if (std::get<0>(keys[k]) == std::get<0>(keys[k - 1]) && std::get<1>(keys[k]) == std::get<1>(keys[k - 1]))
+                    groups.unite(std::get<2>(keys[k]), std::get<2>(keys[k - 1]));
+            }
+        } else {
+            auto left = std::numeric_limits<data::scalar_t>::infinity(), bottom = left;
+            for (const auto& p : points) {
+                left = std::min(left, p.x);
+                bottom = std::min(bottom, p.y);
+            }
+
+            std::vector<std::tuple<std::int64_t, std::int64_t, std::size_t>> keys(n);
+            parallel::parallel_for_chunks(n, [&](std::size_t begin, std::size_t end) {
+                for (auto i = begin; i < end; ++i)
+                    keys[i] = { _details::grid_cell(points[i].x - left, tolerance), _details::grid_cell(points[i].y - bottom, tolerance), i };
+            }, threads);
+            parallel::parallel_sort(keys.begin(), keys.end(), std::less<>{}, threads);
+
+            std::vector<std::pair<std::int64_t, std::int64_t>> cells(n);
+            std::vector<std::size_t> order(n);
+            for (std::size_t k = 0; k < n; ++k) {
+                cells[k] = { std::get<0>(keys[k]), std::get<1>(keys[k]) };
+                order[k] = std::get<2>(keys[k]);
+            }
+
+            // the runs of sites sharing a cell
+            std::vector<std::size_t> run_begin;
+            for (std::size_t k = 0; k < n; ++k) {
+                if (k == 0 || cells[k] != cells[k - 1])
+                    run_begin.push_back(k);
+            }
+            run_begin.push_back(n);
+            const auto runs = run_begin.size() - 1;
+
+            // each cell against itself and the four neighbours after it in the sort, so every pair is seen once
+            const auto squared_tolerance = tolerance * tolerance;
+            std::vector<std::pair<std::size_t, std::size_t>> close;
+            std::mutex merge;
+
+            parallel::parallel_for_chunks(runs, [&](std::size_t begin, std::size_t end) {
+                std::vector<std::pair<std::size_t, std::size_t>> local;
+                auto within = [&points, squared_tolerance](std::size_t a, std::size_t b) {
+                    const auto dx = points[a].x - points[b].x, dy = points[a].y - points[b].y;
+                    return dx * dx + dy * dy <= squared_tolerance;
+                };
+                auto run_of = [&](const std::pair<std::int64_t, std::int64_t>& cell) {
+                    auto r = std::lower_bound(run_begin.begin(), run_begin.end() - 1, cell, [&](std::size_t k, const auto& c) {
+                        return cells[k] < c;
+                    });
+                    return r != run_begin.end() - 1 && cells[*r] == cell ? static_cast<std::size_t>(r - run_begin.begin()) : runs;
+                };
+
+                for (auto r = begin; r < end; ++r) {
+                    for (auto k = run_begin[r]; k < run_begin[r + 1]; ++k) {
+                        for (auto l = k + 1; l < run_begin[r + 1]; ++l) {
+                            if (within(order[k], order[l]))
+                                local.emplace_back(order[k], order[l]);
+                        }
+                    }
+
+                    const auto [cx, cy] = cells[run_begin[r]];
+                    for (const auto& neighbour : { std::pair{ cx, cy + 1 }, std::pair{ cx + 1, cy - 1 }, std::pair{ cx + 1, cy }, std::pair{ cx + 1, cy + 1 } }) {
+                        const auto s = run_of(neighbour);
+                        if (s == runs)
+                            continue;
+
+                        for (auto k = run_begin[r]; k < run_begin[r + 1]; ++k) {
+                            for (auto l = run_begin[s]; l < run_begin[s + 1]; ++l) {
+                                if (within(order[k], order[l]))
+                                    local.emplace_back(order[k], order[l]);
+                            }
+                        }
+                    }
+                }
+
+                std::scoped_lock lock(merge);
+                close.insert(close.end(), local.begin(), local.end());
+            }, threads, 256);
+
+            for (const auto& [a, b] : close)
+                groups.unite(a, b);
+        }
+
+        merged_sites_t merged;
+        merged.representative.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto root = groups.find(i);
+            if (root == i) {
+                merged.representative[i] = merged.points.size();
+                merged.points.push_back(points[i]);
+            } else {
+                merged.representative[i] = merged.representative[root];
+            }
+        }
+
+        return merged;
+    }
+
+} // namespace dvoronoi
+
+#endif //DVORONOI_MERGE_HPP
@@ -0,0 +1,89 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_PARALLEL_HPP
+#define DVORONOI_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace dvoronoi::parallel {
+
+    inline std::size_t thread_count(std::size_t requested = 0) {
+        if (requested > 0)
+            return requested;
+
+        return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    // calls fn(i) for every i in [0, count), items are handed out dynamically so uneven work balances itself
+    void parallel_for(std::size_t count, auto&& fn, std::size_t threads = 0) {
+        threads = std::min(thread_count(threads), count);
+
+        if (threads <= 1) {
+            for (std::size_t i = 0; i < count; ++i)
+                fn(i);
+            return;
+        }
+
+        std::atomic<std::size_t> next{0};
+        auto worker = [&next, &fn, count]() {
+            for (auto i = next.fetch_add(1, std::memory_order_relaxed); i < count; i = next.fetch_add(1, std::memory_order_relaxed))
+                fn(i);
+        };
+
+        std::vector<std::jthread> workers;
+        workers.reserve(threads - 1);
+        for (std::size_t t = 1; t < threads; ++t)
+            workers.emplace_back(worker);
+
+        worker();
+    }
+
+    // splits [0, count) into contiguous chunks, calls fn(begin, end) for each
+    void parallel_for_chunks(std::size_t count, auto&& fn, std::size_t threads = 0, std::size_t min_chunk = 1024) {
+        threads = thread_count(threads);
+
+        auto chunks = std::clamp<std::size_t>(count / std::max<std::size_t>(min_chunk, 1), 1, 4 * threads);
+        auto chunk_size = (count + chunks - 1) / chunks;
+
+        parallel_for(chunks, [&fn, count, chunk_size](std::size_t c) {
+            auto begin = c * chunk_size;
+            auto end = std::min(count, begin + chunk_size);
+            if (begin < end)
+                fn(begin, end);
+        }, threads);
+    }
+
+    // sorts [first, last): contiguous chunks sorted in parallel, then merged pairwise, a round's merges in parallel
+    void parallel_sort(auto first, auto last, auto comp, std::size_t threads = 0) {
+        const auto count = static_cast<std::size_t>(last - first);
+        threads = std::min(thread_count(threads), std::max<std::size_t>(1, count / 4096));
+
+        if (threads <= 1) {
+            std::sort(first, last, comp);
+            return;
+        }
+
+        const auto chunk_size = (count + threads - 1) / threads;
+        parallel_for(threads, [&](std::size_t c) {
+            std::sort(first + std::min(count, c * chunk_size), first + std::min(count, (c + 1) * chunk_size), comp);
+        }, threads);
+
+        for (auto width = chunk_size; width < count; width *= 2) {
+            const auto merges = (count + 2 * width - 1) / (2 * width);
+            parallel_for(merges, [&](std::size_t m) {
+                const auto begin = m * 2 * width;
+                const auto middle = std::min(count, begin + width);
+                const auto end = std::min(count, begin + 2 * width);
+                std::inplace_merge(first + begin, first + middle, first + end, comp);
+            }, threads);
+        }
+    }
+
+} // namespace dvoronoi::parallel
+
+#endif //DVORONOI_PARALLEL_HPP
@@ -0,0 +1,132 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_PERF_COUNTERS_HPP
+#define DVORONOI_PERF_COUNTERS_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+#ifdef __linux__
+#include <cstring>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+namespace dvoronoi::perf {
+
+    enum class counter_t : std::size_t {
+        cycles,
+        instructions,
+        l1d_misses, // L1 data cache read misses
+        llc_misses, // last level cache misses
+        branch_misses,
+        page_faults, // a software counter, first touches of newly allocated memory mostly
+        count
+    };
+
+    inline const char* name(counter_t counter) {
+        constexpr std::array<const char*, static_cast<std::size_t>(counter_t::count)> names{
+            "cycles", "instructions", "L1d misses", "LLC misses", "branch misses", "page faults" };
+        return names[static_cast<std::size_t>(counter)];
+    }
+
+    // counter values, those not available stay 0
+    struct sample_t {
+        std::array<std::uint64_t, static_cast<std::size_t>(counter_t::count)> values{};
+
+        [[nodiscard]] std::uint64_t operator[](counter_t counter) const { return values[static_cast<std::size_t>(counter)]; }
+
+        sample_t& operator+=(const sample_t& other) {
+            for (std::size_t i = 0; i < values.size(); ++i)
+                values[i] += other.values[i];
+            return *this;
+        }
+
+        // clamped at 0, scaled multiplexed counts can step back a little
+        sample_t operator-(const sample_t& other) const {
+            sample_t difference;
+            for (std::size_t i = 0; i < values.size(); ++i)
+                difference.values[i] = values[i] > other.values[i] ? values[i] - other.values[i] : 0;
+            return difference;
+        }
+    };
+
+    // counters of the calling thread, user space only, read through perf_event_open on linux. Each counter is opened on
+    // its own, so the ones the CPU, a virtual machine without a PMU, the kernel's perf_event_paranoid setting or a
+    // container's seccomp profile refuse are just unavailable, all of them on other platforms; values are scaled when
+    // multiplexed
+    class counters_t {
+    public:
+        counters_t() {
+            _fds.fill(-1);
+#ifdef __linux__
+            constexpr auto cache = [](std::uint64_t id, std::uint64_t op, std::uint64_t result) { return id | (op << 8) | (result << 16); };
+            const std::array<std::pair<std::uint32_t, std::uint64_t>, static_cast<std::size_t>(counter_t::count)> events{ {
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+                { PERF_TYPE_HW_CACHE, cache(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS) },
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+                { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS } } };
+
+            for (std::size_t i = 0; i < events.size(); ++i) {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                attr.type = events[i].first;
+                attr.config = events[i].second;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+                _fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+            }
+#endif
+        }
+
+        ~counters_t() {
+#ifdef __linux__
+            for (auto fd : _fds)
+                if (fd >= 0)
+                    close(fd);
+#endif
+        }
+
+        counters_t(const counters_t&) = delete;
+        counters_t& operator=(const counters_t&) = delete;
+
+        [[nodiscard]] bool available(counter_t counter) const { return _fds[static_cast<std::size_t>(counter)] >= 0; }
+        [[nodiscard]] bool any_available() const {
+            for (auto fd : _fds)
+                if (fd >= 0)
+                    return true;
+            return false;
+        }
+
+        [[nodiscard]] sample_t read() const {
+            sample_t sample;
+#ifdef __linux__
+            for (std::size_t i = 0; i < _fds.size(); ++i) {
+                std::uint64_t data[3] = {}; // value, time enabled, time running
+                if (_fds[i] < 0 || ::read(_fds[i], data, sizeof(data)) != sizeof(data))
+                    continue;
+
+                sample.values[i] = data[2] == 0 || data[2] >= data[1] ? data[0] :
+                    static_cast<std::uint64_t>(static_cast<double>(data[0]) * static_cast<double>(data[1]) / static_cast<double>(data[2]));
+            }
+#endif
+            return sample;
+        }
+
+    private:
+        std::array<int, static_cast<std::size_t>(counter_t::count)> _fds{};
+    };
+
+} // namespace dvoronoi::perf
+
+#endif //DVORONOI_PERF_COUNTERS_HPP
@@ -0,0 +1,191 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_POLYGON_HPP
+#define DVORONOI_POLYGON_HPP
+
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <optional>
+#include <algorithm>
+
+#include "data.hpp"
+#include "box.hpp"
+
+namespace dvoronoi {
+
+    // result of clipping the segment a + t * (b - a), t in [0, 1], with a convex polygon;
+    // enter_edge / exit_edge are the polygon edges crossed at t0 / t1, npos when the end point is inside
+    struct segment_clip_t {
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        data::scalar_t t0{0};
+        data::scalar_t t1{1};
+        std::size_t enter_edge{npos};
+        std::size_t exit_edge{npos};
+    };
+
+    // counter-clockwise convex polygon; edge i goes from vertices[i] to vertices[i + 1]
+    class convex_polygon_t {
+    public:
+        // accepts either orientation, collinear and repeated vertices are dropped; nullopt if not convex or degenerate
+        static std::optional<convex_polygon_t> make(std::vector<data::point_t> points) {
+            if (points.size() >= 2 && points.front().x == points.back().x && points.front().y == points.back().y)
+                points.pop_back();
+
+            data::scalar_t area = 0;
+            for (std::size_t i = 0; i < points.size(); ++i)
+                area += points[i].det(points[(i + 1) % points.size()]);
+            if (area < 0)
+                std::ranges::reverse(points);
+
+            convex_polygon_t polygon;
+            for (std::size_t i = 0; i < points.size(); ++i) {
+                const auto& prev = polygon._vertices.empty() ? points.back() : polygon._vertices.back();
+                const auto& next = points[(i + 1) % points.size()];
+                auto turn = prev.cross(points[i], next);
+                if (turn < 0)
+                    return std::nullopt;
+                if (turn > 0)
+                    polygon._vertices.push_back(points[i]);
+            }
+
+            if (polygon._vertices.size() < 3)
+                return std::nullopt;
+
+            polygon.prepare();
+            return polygon;
+        }
+
+        static convex_polygon_t from_box(const box_t& box) {
+            convex_polygon_t polygon;
+            polygon._vertices = { { box.left, box.bottom }, { box.right, box.bottom }, { box.right, box.top }, { box.left, box.top } };
+            polygon.prepare();
+            return polygon;
+        }
+
+        [[nodiscard]] const std::vector<data::point_t>& vertices() const { return _vertices; }
+        [[nodiscard]] std::size_t size() const { return _vertices.size(); }
+        [[nodiscard]] const box_t& bounding_box() const { return _bounding_box; }
+        [[nodiscard]] data::scalar_t tolerance() const { return _tolerance; }
+
+        // signed distance from the line of edge i, positive inside
+        [[nodiscard]] data::scalar_t distance(std::size_t i, const data::point_t& p) const {
+            return _normals[i].x * p.x + _normals[i].y * p.y - _offsets[i];
+        }
+
+        [[nodiscard]] bool contains(const data::point_t& p) const {
+            for (std::size_t i = 0; i < _vertices.size(); ++i)
+                if (distance(i, p) < -_tolerance)
+                    return false;
+            return true;
+        }
+
+        // the edge whose line passes closest to p, for points known to be on the boundary
+        [[nodiscard]] std::size_t nearest_edge(const data::point_t& p) const {
+            std::size_t nearest = 0;
+            for (std::size_t i = 1; i < _vertices.size(); ++i)
+                if (std::fabs(distance(i, p)) < std::fabs(distance(nearest, p)))
+                    nearest = i;
+            return nearest;
+        }
+
+        // position of p along edge i, for ordering points on the same edge
+        [[nodiscard]] data::scalar_t along(std::size_t i, const data::point_t& p) const {
+            return _normals[i].y * (p.x - _vertices[i].x) - _normals[i].x * (p.y - _vertices[i].y);
+        }
+
+        // 1 if the box is inside, -1 if it is outside one of the edges, 0 if it may cross the boundary
+        [[nodiscard]] int classify(const box_t& box) const {
+            if (box.right < _bounding_box.left || box.left > _bounding_box.right || box.top < _bounding_box.bottom || box.bottom > _bounding_box.top)
+                return -1;
+
+            bool inside = true;
+            for (std::size_t i = 0; i < _vertices.size(); ++i) {
+                // the corner farthest in, and the corner farthest out along the normal
+                auto x_in = _normals[i].x > 0 ? box.right : box.left;
+                auto y_in = _normals[i].y > 0 ? box.top : box.bottom;
+                auto x_out = _normals[i].x > 0 ? box.left : box.right;
+                auto y_out = _normals[i].y > 0 ? box.bottom : box.top;
+
+                if (distance(i, { x_in, y_in }) < -_tolerance)
+                    return -1;
+                if (distance(i, { x_out, y_out }) < -_tolerance)
+                    inside = false;
+            }
+
+            return inside ? 1 : 0;
+        }
+
+        // Cyrus-Beck; end points within tolerance of an edge count as inside, so classifying a shared
+        // end point gives the same answer for every segment through it
+        [[nodiscard]] std::optional<segment_clip_t> clip(const data::point_t& a, const data::point_t& b) const {
+            segment_clip_t result;
+
+            for (std::size_t i = 0; i < _vertices.size(); ++i) {
+                auto da = distance(i, a);
+                auto db = distance(i, b);
+                auto a_in = da >= -_tolerance;
+                auto b_in = db >= -_tolerance;
+
+                if (!a_in && !b_in)
+                    return std::nullopt;
+
+                if (!a_in) {
+                    auto t = da / (da - db);
+                    if (t > result.t0) {
+                        result.t0 = t;
+                        result.enter_edge = i;
+                    }
+                } else if (!b_in) {
+                    auto t = da / (da - db);
+                    if (t < result.t1) {
+                        result.t1 = t;
+                        result.exit_edge = i;
+                    }
+                }
+            }
+
+            if (result.t0 >= result.t1)
+                return std::nullopt;
+
+            return result;
+        }
+
+    private:
+        std::vector<data::point_t> _vertices{};
+        std::vector<data::point_t> _normals{}; // unit, pointing inside
+        std::vector<data::scalar_t> _offsets{};
+        box_t _bounding_box{};
+        data::scalar_t _tolerance{0};
+
+        void prepare() {
+            const auto n = _vertices.size();
+            _normals.resize(n);
+            _offsets.resize(n);
+
+            _bounding_box = box_t{ _vertices[0].x, _vertices[0].y, _vertices[0].x, _vertices[0].y };
+            for (const auto& v : _vertices) {
+                _bounding_box.left = std::min(_bounding_box.left, v.x);
+                _bounding_box.bottom = std::min(_bounding_box.bottom, v.y);
+                _bounding_box.right = std::max(_bounding_box.right, v.x);
+                _bounding_box.top = std::max(_bounding_box.top, v.y);
+            }
+
+            for (std::size_t i = 0; i < n; ++i) {
+                auto edge = _vertices[(i + 1) % n] - _vertices[i];
+                _normals[i] = edge.ortho() / edge.norm();
+                _offsets[i] = _normals[i].x * _vertices[i].x + _normals[i].y * _vertices[i].y;
+            }
+
+            auto extent = std::max({ std::fabs(_bounding_box.left), std::fabs(_bounding_box.right),
+                                     std::fabs(_bounding_box.bottom), std::fabs(_bounding_box.top), data::scalar_t(1) });
+            _tolerance = extent * 1e-12;
+        }
+    };
+
+} // namespace dvoronoi
+
+#endif //DVORONOI_POLYGON_HPP
@@ -7,11 +7,20 @@
 
 #include <memory>
 #include <vector>
+#include <memory_resource>
 
 namespace dvoronoi {
 
     template<typename T>
     class priority_queue_t {
+    public:
+        // the elements come from the queue's resource and go back to it
+        struct element_deleter_t {
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource();
+            void operator()(T* elem) { std::pmr::polymorphic_allocator<T>(resource).delete_object(elem); }
+        };
+        typedef std::unique_ptr<T, element_deleter_t> element_h;
+
     private:
         [[nodiscard]] std::make_signed_t<std::size_t> parent(std::size_t idx) const { return (idx + 1LL) / 2LL - 1LL; }
         [[nodiscard]] std::size_t left_child(std::size_t idx) const { return 2 * (idx + 1) - 1; }
@@ -26,24 +35,39 @@ namespace dvoronoi {
         }
 
     public:
-        priority_queue_t() = default;
-        explicit priority_queue_t(std::size_t reserve_size) {
+        explicit priority_queue_t(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : _allocator(resource), _elements(resource), _spare(resource) {}
+        explicit priority_queue_t(std::size_t reserve_size, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : priority_queue_t(resource) {
             _elements.reserve(reserve_size);
         }
 
         [[nodiscard]] bool empty() const { return _elements.empty(); }
         [[nodiscard]] std::size_t size() const { return _elements.size(); }
 
+        void reserve(std::size_t reserve_size) { _elements.reserve(reserve_size); }
+
+        // keeps the elements around, so a reused queue doesn't allocate them again
+        void clear() {
+            for (auto& elem : _elements)
+                _spare.push_back(std::move(elem));
+            _elements.clear();
+        }
+
+        void recycle(element_h elem) { _spare.push_back(std::move(elem)); }
+
         template<class... Args>
         T* emplace(Args&&... args) {
-            const auto& elem = _elements.emplace_back(std::make_unique<T>(args...));
+            const auto& elem = _elements.emplace_back(make_element(args...));
             T* ret = elem.get();
             elem->index = _elements.size() - 1;
             sift_up(_elements.size() - 1);
             return ret;
         }
 
-        std::unique_ptr<T> pop() {
+        [[nodiscard]] const T& top() const { return *_elements.front(); }
+
+        element_h pop() {
             swap(0, _elements.size() - 1);
             auto top = std::move(_elements.back());
             _elements.pop_back();
@@ -53,12 +77,24 @@ namespace dvoronoi {
 
         void remove(std::size_t idx) {
             swap(idx, _elements.size() - 1);
+            _spare.push_back(std::move(_elements.back()));
             _elements.pop_back();
             if (idx < _elements.size())
                 update(idx);
         }
 
     private:
+        template<class... Args>
+        element_h make_element(Args&... args) {
+            if (_spare.empty())
+                return element_h(_allocator.template new_object<T>(args...), element_deleter_t{ _allocator.resource() });
+
+            auto elem = std::move(_spare.back());
+            _spare.pop_back();
+            *elem = T(args...);
+            return elem;
+        }
+
         void swap(std::size_t i, std::size_t j) {
             std::swap(_elements[i], _elements[j]);
             _elements[i]->index = i;
@@ -91,7 +127,9 @@ namespace dvoronoi {
         }
 
     private:
-        std::vector<std::unique_ptr<T>> _elements;
+        std::pmr::polymorphic_allocator<T> _allocator;
+        std::pmr::vector<element_h> _elements;
+        std::pmr::vector<element_h> _spare;
     };
 
 } // namespace dvoronoi
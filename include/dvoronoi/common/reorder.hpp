@@ -0,0 +1,357 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_REORDER_HPP
+#define DVORONOI_REORDER_HPP
+
+#include <cmath>
+#include <span>
+#include <limits>
+#include <cassert>
+#include <vector>
+#include <numeric>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+#include <algorithm>
+
+#include "data.hpp"
+#include "box.hpp"
+#include "parallel.hpp"
+
+namespace dvoronoi {
+
+    // space filling curves for ordering sites, vertices and half edges; Hilbert's keeps consecutive keys adjacent, Morton's
+    // (z-order) jumps at power of two boundaries but is cheaper to compute
+    enum class curve_t { hilbert, morton };
+
+    namespace _details {
+
+        // positions on a 2^16 x 2^16 grid laid over the box, with the same scale on both axes; finer than needed for
+        // locality, sites sharing a cell keep their relative order
+        class curve_grid_t {
+        public:
+            curve_grid_t(const box_t& box, curve_t curve) : _left(box.left), _bottom(box.bottom), _curve(curve) {
+                const auto side = std::max(box.right - box.left, box.top - box.bottom);
+                _scale = side > 0 ? static_cast<data::scalar_t>(std::numeric_limits<std::uint16_t>::max()) / side : 0;
+            }
+
+            [[nodiscard]] std::uint32_t key(const data::point_t& p) const {
+                const auto x = cell(p.x - _left), y = cell(p.y - _bottom);
+                return _curve == curve_t::hilbert ? hilbert_key(x, y) : morton_key(x, y);
+            }
+
+            static std::uint32_t morton_key(std::uint32_t x, std::uint32_t y) {
+                return spread(x) | (spread(y) << 1);
+            }
+
+            // one quadrant per level, branchless as the quadrants of scattered points are unpredictable
+            static std::uint32_t hilbert_key(std::uint32_t x, std::uint32_t y) {
+                std::uint32_t d = 0;
+                for (std::uint32_t s = 1u << 15; s > 0; s >>= 1) {
+                    const std::uint32_t rx = (x & s) ? 1 : 0;
+                    const std::uint32_t ry = (y & s) ? 1 : 0;
+                    d += s * s * ((3 * rx) ^ ry);
+
+                    // rotate the quadrant, only the bits below s matter from now on
+                    const std::uint32_t flip = 0u - (rx & (ry ^ 1));
+                    x ^= flip;
+                    y ^= flip;
+                    const std::uint32_t swap = (x ^ y) & (0u - (ry ^ 1));
+                    x ^= swap;
+                    y ^= swap;
+                }
+                return d;
+            }
+
+        private:
+            [[nodiscard]] std::uint32_t cell(data::scalar_t offset) const {
+                const auto c = offset * _scale;
+                if (!(c > 0))
+                    return 0;
+                return c >= static_cast<data::scalar_t>(std::numeric_limits<std::uint16_t>::max()) ? std::numeric_limits<std::uint16_t>::max() : static_cast<std::uint32_t>(c);
+            }
+
+            static std::uint32_t spread(std::uint32_t v) {
+                v = (v | (v << 8)) & 0x00FF00FFu;
+                v = (v | (v << 4)) & 0x0F0F0F0Fu;
+                v = (v | (v << 2)) & 0x33333333u;
+                v = (v | (v << 1)) & 0x55555555u;
+                return v;
+            }
+
+            data::scalar_t _left, _bottom, _scale{};
+            curve_t _curve;
+        };
+
+        // indices of [0, count) sorted by the curve keys of point_at(i), ties kept in index order
+        auto curve_order(std::size_t count, const auto& point_at, const box_t& box, curve_t curve, std::size_t threads) -> std::vector<std::size_t> {
+            const curve_grid_t grid(box, curve);
+
+            std::vector<std::pair<std::uint32_t, std::size_t>> keys(count);
+            parallel::parallel_for_chunks(count, [&keys, &grid, &point_at](std::size_t begin, std::size_t end) {
+                for (auto i = begin; i < end; ++i)
+                    keys[i] = { grid.key(point_at(i)), i };
+            }, threads);
+
+            std::ranges::sort(keys);
+
+            std::vector<std::size_t> order(count);
+            for (std::size_t i = 0; i < count; ++i)
+                order[i] = keys[i].second;
+            return order;
+        }
+
+        // vertices in the order the half edges reach them first, unreferenced ones last
+        auto vertex_order_along(const auto& diag, const std::vector<std::size_t>& half_edge_order) -> std::vector<std::size_t> {
+            constexpr auto unplaced = std::numeric_limits<std::size_t>::max();
+            std::vector<std::size_t> new_vertex(diag.vertices.size(), unplaced);
+            std::vector<std::size_t> vertex_order;
+            vertex_order.reserve(diag.vertices.size());
+
+            auto place = [&diag, &new_vertex, &vertex_order](const auto* vertex) {
+                if (vertex == nullptr)
+                    return;
+                auto& k = new_vertex[static_cast<std::size_t>(vertex - diag.vertices.data())];
+                if (k == unplaced) {
+                    k = vertex_order.size();
+                    vertex_order.push_back(static_cast<std::size_t>(vertex - diag.vertices.data()));
+                }
+            };
+            for (auto i : half_edge_order) {
+                place(diag.half_edges[i].orig);
+                place(diag.half_edges[i].dest);
+            }
+            for (std::size_t i = 0; i < diag.vertices.size(); ++i) {
+                if (new_vertex[i] == unplaced)
+                    vertex_order.push_back(i);
+            }
+
+            return vertex_order;
+        }
+
+        template<typename T>
+        T* remap(T* p, const T* old_base, T* new_base, const std::vector<std::size_t>& new_index) {
+            return p == nullptr ? nullptr : new_base + new_index[static_cast<std::size_t>(p - old_base)];
+        }
+
+        // lays the arrays out again, element k of each being the one at the order's k-th index before, and relinks
+        // everything in one pass over each; sites keep sharing their position with their face and take it as index
+        void permute(auto& diag, const std::vector<std::size_t>& face_order, const std::vector<std::size_t>& vertex_order,
+                     const std::vector<std::size_t>& half_edge_order, std::size_t threads) {
+            auto inverse = [](const std::vector<std::size_t>& order) {
+                std::vector<std::size_t> inverted(order.size());
+                for (std::size_t k = 0; k < order.size(); ++k)
+                    inverted[order[k]] = k;
+                return inverted;
+            };
+
+            const auto new_face = inverse(face_order);
+            const auto new_vertex = inverse(vertex_order);
+            const auto new_half_edge = inverse(half_edge_order);
+
+            // same resource and capacity, the headroom being relied on for pointer stability
+            std::remove_cvref_t<decltype(diag.sites)> sites(diag.sites.get_allocator());
+            std::remove_cvref_t<decltype(diag.faces)> faces(diag.faces.get_allocator());
+            std::remove_cvref_t<decltype(diag.vertices)> vertices(diag.vertices.get_allocator());
+            std::remove_cvref_t<decltype(diag.half_edges)> half_edges(diag.half_edges.get_allocator());
+            sites.reserve(diag.sites.capacity());
+            faces.reserve(diag.faces.capacity());
+            vertices.reserve(diag.vertices.capacity());
+            half_edges.reserve(diag.half_edges.capacity());
+
+            for (auto k : face_order) {
+                sites.push_back(diag.sites[k]);
+                faces.push_back(diag.faces[k]);
+            }
+
+            parallel::parallel_for_chunks(faces.size(), [&](std::size_t begin, std::size_t end) {
+                for (auto k = begin; k < end; ++k) {
+                    sites[k].index = k;
+                    sites[k].face = &faces[k];
+                    faces[k].site = &sites[k];
+                    faces[k].half_edge = remap(faces[k].half_edge, diag.half_edges.data(), half_edges.data(), new_half_edge);
+                }
+            }, threads);
+
+            // vertices and half edges are scattered from their old order rather than gathered: the ones linked together
+            // were created together, so the lookups stay close and only the writes land anywhere
+            vertices.resize(diag.vertices.size());
+            half_edges.resize(diag.half_edges.size());
+
+            parallel::parallel_for_chunks(vertices.size(), [&](std::size_t begin, std::size_t end) {
+                for (auto i = begin; i < end; ++i) {
+                    auto& vertex = vertices[new_vertex[i]];
+                    vertex = diag.vertices[i];
+                    vertex.index = new_vertex[i];
+                }
+            }, threads);
+
+            parallel::parallel_for_chunks(half_edges.size(), [&](std::size_t begin, std::size_t end) {
+                for (auto i = begin; i < end; ++i) {
+                    const auto& old = diag.half_edges[i];
+                    auto& he = half_edges[new_half_edge[i]];
+                    he.index = new_half_edge[i];
+                    he.orig = remap(old.orig, diag.vertices.data(), vertices.data(), new_vertex);
+                    he.dest = remap(old.dest, diag.vertices.data(), vertices.data(), new_vertex);
+                    he.twin = remap(old.twin, diag.half_edges.data(), half_edges.data(), new_half_edge);
+                    he.face = remap(old.face, diag.faces.data(), faces.data(), new_face);
+                    he.prev = remap(old.prev, diag.half_edges.data(), half_edges.data(), new_half_edge);
+                    he.next = remap(old.next, diag.half_edges.data(), half_edges.data(), new_half_edge);
+                }
+            }, threads);
+
+            // the derived tables hold site indices
+            if (diag.triangulation) {
+                std::remove_cvref_t<decltype(*diag.triangulation)> triangulation(face_order.size());
+                for (std::size_t k = 0; k < face_order.size(); ++k) {
+                    triangulation[k] = std::move((*diag.triangulation)[face_order[k]]);
+                    for (auto& neighbour : triangulation[k])
+                        neighbour = new_face[neighbour];
+                }
+                *diag.triangulation = std::move(triangulation);
+            }
+            if (diag.convex_hull) {
+                for (auto& i : *diag.convex_hull)
+                    i = new_face[i];
+            }
+            if (diag.input_faces) {
+                for (auto& i : *diag.input_faces)
+                    i = new_face[i];
+            }
+
+            diag.sites = std::move(sites);
+            diag.faces = std::move(faces);
+            diag.vertices = std::move(vertices);
+            diag.half_edges = std::move(half_edges);
+        }
+
+    } // namespace _details
+
+    // the sites' permutation along the curve over their extents: order[k] is the index of the k-th site. Handing the
+    // sites to generate in this order lays the diagram out along the curve up front, order mapping the faces back
+    auto spatial_order(const auto& sites, curve_t curve = curve_t::hilbert, std::size_t threads = 0) -> std::vector<std::size_t> {
+        if (sites.empty())
+            return {};
+
+        auto extents = box_t{ sites[0].x, sites[0].y, sites[0].x, sites[0].y };
+        for (const auto& s : sites) {
+            extents.left = std::min<data::scalar_t>(extents.left, s.x);
+            extents.bottom = std::min<data::scalar_t>(extents.bottom, s.y);
+            extents.right = std::max<data::scalar_t>(extents.right, s.x);
+            extents.top = std::max<data::scalar_t>(extents.top, s.y);
+        }
+
+        return _details::curve_order(sites.size(), [&sites](std::size_t i) {
+            return data::point_t{ static_cast<data::scalar_t>(sites[i].x), static_cast<data::scalar_t>(sites[i].y) };
+        }, extents, curve, threads);
+    }
+
+    // renumbers a generated diagram for locality: sites and faces by their sites' positions along the curve, half edges
+    // grouped by face in the faces' new order, vertices as the half edges reach them. Every link is rewritten, the diagram stays
+    // valid. Returns the mapping back: original[i] is the index site i had before the call
+    auto reorder(auto& diag, curve_t curve = curve_t::hilbert, std::size_t threads = 0) -> std::vector<std::size_t> {
+        const auto n = diag.faces.size();
+        if (n == 0)
+            return {};
+
+        auto extents = box_t{ diag.sites[0].point.x, diag.sites[0].point.y, diag.sites[0].point.x, diag.sites[0].point.y };
+        for (const auto& site : diag.sites) {
+            extents.left = std::min(extents.left, site.point.x);
+            extents.bottom = std::min(extents.bottom, site.point.y);
+            extents.right = std::max(extents.right, site.point.x);
+            extents.top = std::max(extents.top, site.point.y);
+        }
+
+        auto face_order = _details::curve_order(n, [&diag](std::size_t i) { return diag.sites[i].point; }, extents, curve, threads);
+
+        // a stable counting sort by the faces' new positions, faceless half edges last
+        std::vector<std::size_t> new_face(n);
+        for (std::size_t k = 0; k < n; ++k)
+            new_face[face_order[k]] = k;
+
+        std::vector<std::size_t> offsets(n + 2, 0);
+        auto bucket = [&diag, &new_face, n](const auto& he) {
+            return he.face == nullptr ? n : new_face[static_cast<std::size_t>(he.face - diag.faces.data())];
+        };
+        for (const auto& he : diag.half_edges)
+            ++offsets[bucket(he) + 1];
+        for (std::size_t k = 1; k < offsets.size(); ++k)
+            offsets[k] += offsets[k - 1];
+
+        std::vector<std::size_t> half_edge_order(diag.half_edges.size());
+        for (std::size_t i = 0; i < diag.half_edges.size(); ++i)
+            half_edge_order[offsets[bucket(diag.half_edges[i])]++] = i;
+
+        // vertices as the half edges reach them, which follows the curve too without sorting them
+        const auto vertex_order = _details::vertex_order_along(diag, half_edge_order);
+
+        _details::permute(diag, face_order, vertex_order, half_edge_order, threads);
+        return face_order;
+    }
+
+    // lays every face's half edges out consecutively in ring order, faces and vertices keeping theirs, and rewrites
+    // every link. face.half_edge becomes the first of its run, for the open rings of unbounded diagrams the start of
+    // the chain. Closed rings can then be scanned linearly, see ring()
+    void compact_rings(auto& diag, std::size_t threads = 0) {
+        const auto n = diag.faces.size();
+
+        std::vector<std::size_t> face_order(n);
+        std::iota(face_order.begin(), face_order.end(), 0);
+        std::vector<std::size_t> half_edge_order;
+        half_edge_order.reserve(diag.half_edges.size());
+        std::vector<std::size_t> run_begin(n, 0);
+        std::vector<std::uint8_t> placed(diag.half_edges.size(), 0);
+
+        for (std::size_t f = 0; f < n; ++f) {
+            run_begin[f] = half_edge_order.size();
+
+            const auto* first = diag.faces[f].half_edge;
+            if (first == nullptr)
+                continue;
+
+            // back to the start of an open chain, rings going around at most once
+            const auto* start = first;
+            for (std::size_t steps = 0; start->prev != nullptr && start->prev != first && steps < diag.half_edges.size(); ++steps)
+                start = start->prev;
+
+            const auto* he = start;
+            do {
+                placed[he->index] = 1;
+                half_edge_order.push_back(he->index);
+                he = he->next;
+            } while (he != nullptr && he != start && !placed[he->index]);
+        }
+
+        // anything on no ring keeps its relative order, after all of them
+        for (std::size_t i = 0; i < diag.half_edges.size(); ++i) {
+            if (!placed[i])
+                half_edge_order.push_back(i);
+        }
+
+        // vertices stay, numbering them along the rings costs more than it saves on the scans
+        std::vector<std::size_t> vertex_order(diag.vertices.size());
+        std::iota(vertex_order.begin(), vertex_order.end(), 0);
+
+        _details::permute(diag, face_order, vertex_order, half_edge_order, threads);
+
+        for (std::size_t f = 0; f < n; ++f) {
+            if (diag.faces[f].half_edge != nullptr)
+                diag.faces[f].half_edge = &diag.half_edges[run_begin[f]];
+        }
+    }
+
+    // a closed ring laid out by compact_rings, as the contiguous run of its half edges
+    auto ring(const auto& diag, const auto& face) {
+        using half_edge_t = std::remove_cvref_t<decltype(diag.half_edges[0])>;
+        if (face.half_edge == nullptr)
+            return std::span<const half_edge_t>{};
+
+        assert(face.half_edge->prev != nullptr && face.half_edge->prev->index >= face.half_edge->index);
+        return std::span<const half_edge_t>{ face.half_edge, face.half_edge->prev->index - face.half_edge->index + 1 };
+    }
+
+} // namespace dvoronoi
+
+#endif //DVORONOI_REORDER_HPP
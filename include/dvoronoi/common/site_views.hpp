@@ -0,0 +1,45 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_SITE_VIEWS_HPP
+#define DVORONOI_SITE_VIEWS_HPP
+
+#include <cstddef>
+
+namespace dvoronoi {
+
+    // Non-owning views that algorithm::generate accepts in place of a container of points, so that sites
+    // stored in some other layout don't have to be copied into an array of points first.
+    // A std::span of anything with .x/.y works as is.
+
+    // x and y read from two arrays with a common stride in bytes, e.g. separate x/y arrays (stride sizeof(T)),
+    // interleaved x, y pairs (stride 2 * sizeof(T)) or one member pair of an array of structs (stride sizeof(struct))
+    template<typename T>
+    class strided_sites_t {
+    public:
+        struct point_t {
+            T x;
+            T y;
+        };
+
+        strided_sites_t(const T* x, const T* y, std::size_t count, std::size_t stride = sizeof(T))
+            : _x(reinterpret_cast<const std::byte*>(x)), _y(reinterpret_cast<const std::byte*>(y)), _count(count), _stride(stride) {}
+
+        [[nodiscard]] std::size_t size() const { return _count; }
+        [[nodiscard]] bool empty() const { return _count == 0; }
+
+        point_t operator[](std::size_t i) const {
+            return { *reinterpret_cast<const T*>(_x + i * _stride), *reinterpret_cast<const T*>(_y + i * _stride) };
+        }
+
+    private:
+        const std::byte* _x;
+        const std::byte* _y;
+        std::size_t _count;
+        std::size_t _stride;
+    };
+
+} // namespace dvoronoi
+
+#endif //DVORONOI_SITE_VIEWS_HPP
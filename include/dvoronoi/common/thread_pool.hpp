@@ -0,0 +1,171 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_THREAD_POOL_HPP
+#define DVORONOI_THREAD_POOL_HPP
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+#include "parallel.hpp"
+
+namespace dvoronoi::parallel {
+
+    // persistent workers with work stealing: every worker owns a range of item indices, takes items from its front
+    // and, once it runs dry, steals the back half of another worker's range. The calling thread is worker 0.
+    class thread_pool_t {
+    public:
+        explicit thread_pool_t(std::size_t threads = 0) {
+            threads = thread_count(threads);
+
+            _ranges.reserve(threads);
+            for (std::size_t w = 0; w < threads; ++w)
+                _ranges.emplace_back(std::make_unique<range_t>());
+
+            _threads.reserve(threads - 1);
+            for (std::size_t w = 1; w < threads; ++w)
+                _threads.emplace_back([this, w]() { worker_loop(w); });
+        }
+
+        ~thread_pool_t() {
+            {
+                std::scoped_lock lock(_mutex);
+                _stop = true;
+            }
+            _wake.notify_all();
+        }
+
+        thread_pool_t(const thread_pool_t&) = delete;
+        thread_pool_t& operator=(const thread_pool_t&) = delete;
+
+        [[nodiscard]] std::size_t size() const { return _ranges.size(); }
+
+        // calls fn(worker, i) for every i in [0, count) and returns when all of them are done, not reentrant
+        void for_each(std::size_t count, std::function<void(std::size_t, std::size_t)> fn) {
+            if (count == 0)
+                return;
+
+            const auto workers = size();
+            const auto chunk = count / workers;
+            const auto extra = count % workers;
+
+            std::size_t begin = 0;
+            for (std::size_t w = 0; w < workers; ++w) {
+                auto end = begin + chunk + (w < extra ? 1 : 0);
+                std::scoped_lock lock(_ranges[w]->mutex);
+                _ranges[w]->begin = begin;
+                _ranges[w]->end = end;
+                begin = end;
+            }
+
+            {
+                std::scoped_lock lock(_mutex);
+                _task = std::move(fn);
+                _active = workers - 1;
+                ++_generation;
+            }
+            _wake.notify_all();
+
+            work(0);
+
+            std::unique_lock lock(_mutex);
+            _done.wait(lock, [this]() { return _active == 0; });
+            _task = nullptr;
+        }
+
+    private:
+        struct alignas(64) range_t {
+            std::mutex mutex{};
+            std::size_t begin{};
+            std::size_t end{};
+        };
+
+        void worker_loop(std::size_t worker) {
+            std::size_t generation = 0;
+
+            while (true) {
+                {
+                    std::unique_lock lock(_mutex);
+                    _wake.wait(lock, [this, generation]() { return _stop || _generation != generation; });
+                    if (_stop)
+                        return;
+                    generation = _generation;
+                }
+
+                work(worker);
+
+                {
+                    std::scoped_lock lock(_mutex);
+                    --_active;
+                }
+                _done.notify_one();
+            }
+        }
+
+        void work(std::size_t worker) {
+            std::size_t i;
+            while (pop(worker, i) || steal(worker, i))
+                _task(worker, i);
+        }
+
+        bool pop(std::size_t worker, std::size_t& i) {
+            auto& range = *_ranges[worker];
+            std::scoped_lock lock(range.mutex);
+
+            if (range.begin == range.end)
+                return false;
+
+            i = range.begin++;
+            return true;
+        }
+
+        bool steal(std::size_t thief, std::size_t& i) {
+            const auto workers = size();
+
+            for (std::size_t offset = 1; offset < workers; ++offset) {
+                auto& victim = *_ranges[(thief + offset) % workers];
+
+                std::size_t begin, end;
+                {
+                    std::scoped_lock lock(victim.mutex);
+                    if (victim.begin == victim.end)
+                        continue;
+
+                    begin = victim.begin + (victim.end - victim.begin) / 2;
+                    end = victim.end;
+                    victim.end = begin;
+                }
+
+                auto& own = *_ranges[thief];
+                std::scoped_lock lock(own.mutex);
+                own.begin = begin + 1;
+                own.end = end;
+                i = begin;
+                return true;
+            }
+
+            return false;
+        }
+
+    private:
+        std::vector<std::unique_ptr<range_t>> _ranges;
+
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _done;
+        std::function<void(std::size_t, std::size_t)> _task;
+        std::size_t _generation{0};
+        std::size_t _active{0};
+        bool _stop{false};
+
+        std::vector<std::jthread> _threads; // last, so the workers are joined before the rest is destroyed
+    };
+
+} // namespace dvoronoi::parallel
+
+#endif //DVORONOI_THREAD_POOL_HPP
@@ -6,38 +6,61 @@
 #define TRACING_RESOURCE_HPP
 
 #include <memory_resource>
-#include <iostream>
+#include <algorithm>
+#include <ostream>
+#include <string>
 
 namespace dvoronoi::memory_management {
 
+struct memory_usage_t {
+    std::size_t current_bytes{0};
+    std::size_t peak_bytes{0};
+    std::size_t allocations{0};
+    std::size_t deallocations{0};
+};
+
+// forwards to next, keeping count of what goes through it; every call is also logged when given a stream.
+// Not thread safe, like the structures it is meant for
 class tracing_resource final : public std::pmr::memory_resource {
 public:
-    tracing_resource(const std::string& name, std::pmr::memory_resource* next = std::pmr::get_default_resource(), std::ostream& out = std::cout)
+    explicit tracing_resource(const std::string& name, std::pmr::memory_resource* next = std::pmr::get_default_resource(), std::ostream* out = nullptr)
         : _name(name), _next(next), _out(out) {}
 
+    [[nodiscard]] const std::string& name() const { return _name; }
+    [[nodiscard]] const memory_usage_t& usage() const { return _usage; }
+
+    // starts a new peak from the current bytes, e.g. between runs
+    void reset_peak() { _usage.peak_bytes = _usage.current_bytes; }
+
 private:
     void* do_allocate(std::size_t bytes, std::size_t align) override {
         auto* addr = _next->allocate(bytes, align);
-        _out << '[' << _name << "] allocate(" << bytes << ", " << align << ") -> " << addr << std::endl;
+        _usage.current_bytes += bytes;
+        _usage.peak_bytes = std::max(_usage.peak_bytes, _usage.current_bytes);
+        ++_usage.allocations;
+        if (_out != nullptr)
+            *_out << '[' << _name << "] allocate(" << bytes << ", " << align << ") -> " << addr << std::endl;
         return addr;
     }
 
     void do_deallocate(void* addr, std::size_t bytes, std::size_t align) override {
-        _out << '[' << _name << "] deallocate(" << addr << ", " << bytes << ", " << align << ")\n";
+        if (_out != nullptr)
+            *_out << '[' << _name << "] deallocate(" << addr << ", " << bytes << ", " << align << ")\n";
+        _usage.current_bytes -= bytes;
+        ++_usage.deallocations;
         _next->deallocate(addr, bytes, align);
     }
 
-    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
-        auto p = dynamic_cast<const tracing_resource*>(&other);
-        return p && _next == p->_next;
-    }
+    // only itself, memory handed over to another resource would be counted there when freed
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
 
 private:
     std::string _name;
     std::pmr::memory_resource* _next;
-    std::ostream& _out;
+    std::ostream* _out;
+    memory_usage_t _usage{};
 };
 
 }
 
-#endif //TRACING_RESOURCE_HPP
\ No newline at end of file
+#endif //TRACING_RESOURCE_HPP
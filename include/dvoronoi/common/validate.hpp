@@ -0,0 +1,223 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_VALIDATE_HPP
+#define DVORONOI_VALIDATE_HPP
+
+#include <mutex>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+#include "data.hpp"
+#include "box.hpp"
+#include "parallel.hpp"
+
+namespace dvoronoi {
+
+    struct validation_options_t {
+        // relative tolerance of the turn and side tests, scaled by the lengths and the distances to the site involved
+        data::scalar_t tolerance{1e-9};
+        // the domain of a periodic diagram: vertices are unwrapped around their cell's site, every edge needs a twin and
+        // the torus has Euler characteristic 0 instead of 1
+        std::optional<box_t> periodic{};
+    };
+
+    // problem counts found in a diagram, all 0 and Euler's formula holding for a valid one
+    struct validation_t {
+        std::size_t broken_links{};      // pointers out of their array, or twin, next, prev, face, index not agreeing
+        std::size_t open_faces{};        // rings not closing, or passing through other faces' half edges
+        std::size_t non_convex_faces{};  // rings turning clockwise, winding more than once or enclosing no area
+        std::size_t sites_outside{};     // sites on the outer side of one of their cell's bisectors; clipped cells can
+                                         // leave their site out, beyond their twinless edges
+        std::size_t stray_half_edges{};  // half edges on no face's ring
+        std::size_t empty_faces{};       // faces without half edges, sites clipped away; not an error
+        std::size_t zero_length_edges{}; // from cocircular sites, the sweep keeps them; not an error
+        std::ptrdiff_t euler_characteristic{}; // V - E + F, over the closed faces
+        bool euler_holds{};
+
+        [[nodiscard]] bool valid() const {
+            return broken_links == 0 && open_faces == 0 && non_convex_faces == 0 && sites_outside == 0 && stray_half_edges == 0 && euler_holds;
+        }
+
+        validation_t& operator+=(const validation_t& other) {
+            broken_links += other.broken_links;
+            open_faces += other.open_faces;
+            non_convex_faces += other.non_convex_faces;
+            sites_outside += other.sites_outside;
+            stray_half_edges += other.stray_half_edges;
+            empty_faces += other.empty_faces;
+            zero_length_edges += other.zero_length_edges;
+            return *this;
+        }
+    };
+
+    inline std::ostream& operator<<(std::ostream& out, const validation_t& v) {
+        out << (v.valid() ? "valid" : "INVALID") << ": " << v.broken_links << " broken links, " << v.open_faces << " open faces, "
+            << v.non_convex_faces << " non convex faces, " << v.sites_outside << " sites outside, " << v.stray_half_edges << " stray half edges, "
+            << v.empty_faces << " empty faces, " << v.zero_length_edges << " zero length edges, Euler characteristic " << v.euler_characteristic
+            << (v.euler_holds ? "" : " (wrong)");
+        return out;
+    }
+
+    namespace _details {
+        template<typename T>
+        bool points_into(const T* p, const auto& storage) {
+            return p != nullptr && p >= storage.data() && p < storage.data() + storage.size();
+        }
+    }
+
+    // checks a bounded, clipped or periodic diagram in two parallel linear passes: the links of every half edge and
+    // vertex, then every face's ring, walked once, for closure, convexity and its site. Pointers are range checked
+    // before being followed, so broken diagrams are reported rather than crashed on. Unbounded diagrams have open rings
+    auto validate(const auto& diag, const validation_options_t& options = validation_options_t{}, std::size_t threads = 0) -> validation_t {
+        using _details::points_into;
+
+        validation_t result;
+        std::mutex merge;
+
+        std::vector<std::uint8_t> used_vertices(diag.vertices.size(), 0);
+        std::atomic<std::size_t> twinned{0}, untwinned{0};
+
+        parallel::parallel_for_chunks(diag.half_edges.size(), [&](std::size_t begin, std::size_t end) {
+            validation_t local;
+            std::size_t local_twinned = 0, local_untwinned = 0;
+
+            for (auto i = begin; i < end; ++i) {
+                const auto* he = &diag.half_edges[i];
+
+                bool ok = he->index == i && points_into(he->face, diag.faces) && points_into(he->orig, diag.vertices) && points_into(he->dest, diag.vertices)
+                        && points_into(he->next, diag.half_edges) && points_into(he->prev, diag.half_edges);
+                if (ok) {
+                    ok = he->next->prev == he && he->prev->next == he && he->next->face == he->face && he->next->orig == he->dest;
+                    std::atomic_ref<std::uint8_t>(used_vertices[static_cast<std::size_t>(he->orig - diag.vertices.data())]).store(1, std::memory_order_relaxed);
+                    if (he->orig->point.x == he->dest->point.x && he->orig->point.y == he->dest->point.y)
+                        ++local.zero_length_edges;
+                }
+
+                if (he->twin == nullptr) {
+                    ok = ok && !options.periodic.has_value();
+                    ++local_untwinned;
+                } else {
+                    ok = ok && points_into(he->twin, diag.half_edges) && he->twin != he && he->twin->twin == he && he->twin->face != he->face
+                            && he->twin->orig == he->dest && he->twin->dest == he->orig;
+                    ++local_twinned;
+                }
+
+                if (!ok)
+                    ++local.broken_links;
+            }
+
+            twinned += local_twinned;
+            untwinned += local_untwinned;
+            std::scoped_lock lock(merge);
+            result += local;
+        }, threads);
+
+        for (std::size_t i = 0; i < diag.vertices.size(); ++i)
+            result.broken_links += diag.vertices[i].index != i ? 1 : 0;
+
+        std::atomic<std::size_t> ring_half_edges{0}, closed_faces{0};
+
+        parallel::parallel_for_chunks(diag.faces.size(), [&](std::size_t begin, std::size_t end) {
+            validation_t local;
+            std::size_t local_ring_half_edges = 0, local_closed_faces = 0;
+
+            for (auto i = begin; i < end; ++i) {
+                const auto& face = diag.faces[i];
+                if (!points_into(face.site, diag.sites) || face.site->face != &face || diag.sites[i].face != &face) {
+                    ++local.broken_links;
+                    continue;
+                }
+                if (face.half_edge == nullptr) {
+                    ++local.empty_faces;
+                    continue;
+                }
+
+                // positions relative to the site, unwrapped around it for periodic diagrams
+                const auto site = face.site->point;
+                auto relative = [&site, &options](const data::point_t& p) {
+                    if (!options.periodic.has_value())
+                        return p - site;
+
+                    const auto w = options.periodic->right - options.periodic->left;
+                    const auto h = options.periodic->top - options.periodic->bottom;
+                    auto d = p - site;
+                    d.x -= w * std::round(d.x / w);
+                    d.y -= h * std::round(d.y / h);
+                    return d;
+                };
+
+                bool closed = true, convex = true, inside = true, enclosed = true;
+                data::scalar_t area = 0;
+                int winding = 0;
+                std::size_t length = 0;
+
+                const auto* he = face.half_edge;
+                do {
+                    if (!points_into(he, diag.half_edges) || he->face != &face || !points_into(he->orig, diag.vertices) || !points_into(he->dest, diag.vertices)
+                        || !points_into(he->next, diag.half_edges) || !points_into(he->next->dest, diag.vertices) || ++length > diag.half_edges.size()) {
+                        closed = false;
+                        break;
+                    }
+
+                    const auto a = relative(he->orig->point);
+                    const auto b = relative(he->dest->point);
+                    const auto c = relative(he->next->dest->point);
+                    const auto edge = b - a;
+                    const auto next_edge = c - b;
+
+                    // the direction of an edge a few ulps long is noise, hence the distances in the tolerances
+                    area += a.det(b);
+                    convex = convex && edge.det(next_edge) >= -options.tolerance * (edge.norm() + b.norm()) * (next_edge.norm() + b.norm());
+                    const auto side = edge.det(data::point_t{} - a) >= -options.tolerance * (edge.norm() + a.norm()) * a.norm();
+                    inside = inside && (side || he->twin == nullptr);
+                    enclosed = enclosed && side;
+
+                    // crossings of the ray from the site along +x, signed by direction
+                    if (a.y <= 0 && b.y > 0 && a.det(b) > 0)
+                        ++winding;
+                    else if (a.y > 0 && b.y <= 0 && a.det(b) < 0)
+                        --winding;
+
+                    he = he->next;
+                } while (he != face.half_edge);
+
+                if (!closed) {
+                    ++local.open_faces;
+                    continue;
+                }
+
+                ++local_closed_faces;
+                local_ring_half_edges += length;
+                if (!convex || area <= 0 || length < 3 || (enclosed && winding != 1))
+                    ++local.non_convex_faces;
+                if (!inside)
+                    ++local.sites_outside;
+            }
+
+            ring_half_edges += local_ring_half_edges;
+            closed_faces += local_closed_faces;
+            std::scoped_lock lock(merge);
+            result += local;
+        }, threads);
+
+        result.stray_half_edges = diag.half_edges.size() > ring_half_edges ? diag.half_edges.size() - ring_half_edges : 0;
+
+        std::ptrdiff_t vertices = 0;
+        for (auto used : used_vertices)
+            vertices += used;
+        const auto edges = static_cast<std::ptrdiff_t>(twinned / 2 + untwinned);
+        result.euler_characteristic = vertices - edges + static_cast<std::ptrdiff_t>(closed_faces.load());
+        result.euler_holds = result.euler_characteristic == (options.periodic.has_value() ? 0 : 1);
+
+        return result;
+    }
+
+} // namespace dvoronoi
+
+#endif //DVORONOI_VALIDATE_HPP
@@ -0,0 +1,361 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_CVT_SOLVER_HPP
+#define DVORONOI_CVT_SOLVER_HPP
+
+#include <mutex>
+#include <cmath>
+#include <chrono>
+#include <deque>
+#include <limits>
+#include <vector>
+#include <cassert>
+#include <algorithm>
+
+#include "dvoronoi/common/data.hpp"
+#include "dvoronoi/common/box.hpp"
+#include "dvoronoi/common/parallel.hpp"
+#include "dvoronoi/sweep_hull/algorithm.hpp"
+
+namespace dvoronoi::cvt {
+
+    // a piecewise constant density over the domain, width x height pixels laid out like raster labels: row r spans
+    // [domain.bottom + r * pixel height, + pixel height), rows stored contiguously from the bottom one
+    struct density_t {
+        box_t domain{};
+        std::size_t width{0};
+        std::size_t height{0};
+        std::vector<data::scalar_t> values{}; // non negative, 0 outside the domain
+
+        [[nodiscard]] data::scalar_t at(std::size_t row, std::size_t column) const { return values[row * width + column]; }
+    };
+
+    enum class method_t {
+        lloyd, // sites moved to their cells' centroids
+        lbfgs  // quasi Newton steps on the energy, preconditioned by the cells' masses, falling back to Lloyd's
+    };
+
+    struct options_t {
+        method_t method{method_t::lloyd};
+        std::size_t iterations{100};
+        // stops once the gradient's norm falls below this, relative to the density's total mass and the domain's size
+        data::scalar_t tolerance{1e-6};
+        std::size_t history{7}; // L-BFGS correction pairs kept
+        std::size_t threads{0};
+    };
+
+    // an iterate: the energy, sum over the cells of the density weighted squared distances to their sites, and its
+    // gradient's norm at the sites the iteration started from
+    struct iteration_t {
+        data::scalar_t energy{};
+        data::scalar_t gradient_norm{};
+        double milliseconds{};
+        std::size_t evaluations{}; // diagrams generated and integrated, more than one when a line search backtracked
+    };
+
+    struct result_t {
+        std::vector<data::point_t> sites{};
+        std::vector<iteration_t> iterations{};
+        bool converged{false};
+    };
+
+    // the energy and the cells' masses and centroids at some sites
+    struct evaluation_t {
+        data::scalar_t energy{};
+        std::vector<data::scalar_t> mass{};
+        std::vector<data::point_t> centroid{}; // the site itself for cells without mass
+        std::vector<data::point_t> gradient{}; // 2 * mass * (site - centroid)
+    };
+
+    namespace _details {
+
+        struct cell_moments_t {
+            data::scalar_t mass{};
+            data::scalar_t mx{}, my{}; // first moments, relative to the site
+            data::scalar_t energy{};
+        };
+
+        // per row prefix integrals of the density times 1, u and u^2 up to every pixel's left side, u measured from
+        // the domain's left side, so any span of a row integrates in O(1), exactly along x
+        class density_table_t {
+        public:
+            explicit density_table_t(const density_t& density) : _density(density) {
+                _pixel_w = (density.domain.right - density.domain.left) / static_cast<data::scalar_t>(density.width);
+                _pixel_h = (density.domain.top - density.domain.bottom) / static_cast<data::scalar_t>(density.height);
+
+                const auto stride = density.width + 1;
+                for (auto* table : { &_p0, &_p1, &_p2 })
+                    table->assign(stride * density.height, 0);
+
+                parallel::parallel_for(density.height, [this, &density, stride](std::size_t r) {
+                    for (std::size_t c = 0; c < density.width; ++c) {
+                        const auto rho = density.at(r, c);
+                        const auto u0 = static_cast<data::scalar_t>(c) * _pixel_w, u1 = u0 + _pixel_w;
+                        _p0[r * stride + c + 1] = _p0[r * stride + c] + rho * (u1 - u0);
+                        _p1[r * stride + c + 1] = _p1[r * stride + c] + rho * (u1 * u1 - u0 * u0) / 2;
+                        _p2[r * stride + c + 1] = _p2[r * stride + c] + rho * (u1 * u1 * u1 - u0 * u0 * u0) / 3;
+                    }
+                });
+            }
+
+            [[nodiscard]] const density_t& density() const { return _density; }
+            [[nodiscard]] data::scalar_t pixel_w() const { return _pixel_w; }
+            [[nodiscard]] data::scalar_t pixel_h() const { return _pixel_h; }
+
+            // the integrals of rho, rho * u and rho * u^2 over [u0, u1] along row r
+            void integrate_row(std::size_t r, data::scalar_t u0, data::scalar_t u1, data::scalar_t& i0, data::scalar_t& i1, data::scalar_t& i2) const {
+                data::scalar_t a0, a1, a2, b0, b1, b2;
+                cumulative(r, u0, a0, a1, a2);
+                cumulative(r, u1, b0, b1, b2);
+                i0 = b0 - a0;
+                i1 = b1 - a1;
+                i2 = b2 - a2;
+            }
+
+        private:
+            void cumulative(std::size_t r, data::scalar_t u, data::scalar_t& m0, data::scalar_t& m1, data::scalar_t& m2) const {
+                const auto stride = _density.width + 1;
+                const auto c = std::min(static_cast<std::size_t>(std::max<data::scalar_t>(0, u / _pixel_w)), _density.width - 1);
+                const auto uc = static_cast<data::scalar_t>(c) * _pixel_w;
+                const auto rho = _density.at(r, c);
+
+                m0 = _p0[r * stride + c] + rho * (u - uc);
+                m1 = _p1[r * stride + c] + rho * (u * u - uc * uc) / 2;
+                m2 = _p2[r * stride + c] + rho * (u * u * u - uc * uc * uc) / 3;
+            }
+
+            density_t _density; // a copy, the caller's can go
+            data::scalar_t _pixel_w{}, _pixel_h{};
+            std::vector<data::scalar_t> _p0{}, _p1{}, _p2{};
+        };
+
+        // scans the convex cell row by row like rasterize does: the cell's span at every row's center is integrated
+        // exactly along x, the density taken as constant over the row's height
+        inline cell_moments_t integrate_cell(const auto& face, const density_table_t& table, std::vector<data::scalar_t>& left, std::vector<data::scalar_t>& right) {
+            cell_moments_t moments;
+            if (face.half_edge == nullptr)
+                return moments;
+
+            const auto& density = table.density();
+            const auto& domain = density.domain;
+            const auto pixel_h = table.pixel_h();
+            const auto site = face.site->point;
+
+            auto y_min = std::numeric_limits<data::scalar_t>::infinity();
+            auto y_max = -y_min;
+            auto he = face.half_edge;
+            do {
+                y_min = std::min(y_min, he->orig->point.y);
+                y_max = std::max(y_max, he->orig->point.y);
+                he = he->next;
+            } while (he != face.half_edge);
+
+            const auto first_row = static_cast<std::size_t>(std::clamp(std::ceil((y_min - domain.bottom) / pixel_h - 0.5), 0.0, static_cast<double>(density.height)));
+            const auto last_row = static_cast<std::size_t>(std::clamp(std::ceil((y_max - domain.bottom) / pixel_h - 0.5), 0.0, static_cast<double>(density.height)));
+            if (first_row >= last_row)
+                return moments;
+
+            const auto rows = last_row - first_row;
+            left.assign(rows, std::numeric_limits<data::scalar_t>::infinity());
+            right.assign(rows, -std::numeric_limits<data::scalar_t>::infinity());
+
+            he = face.half_edge;
+            do {
+                auto p0 = he->orig->point;
+                auto p1 = he->dest->point;
+                if (p1.y < p0.y)
+                    std::swap(p0, p1);
+
+                const auto r0 = std::max<data::scalar_t>(std::ceil((p0.y - domain.bottom) / pixel_h - 0.5), static_cast<data::scalar_t>(first_row));
+                const auto r1 = std::min<data::scalar_t>(std::ceil((p1.y - domain.bottom) / pixel_h - 0.5), static_cast<data::scalar_t>(last_row));
+                if (r0 < r1) {
+                    const auto dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+                    for (auto r = static_cast<std::size_t>(r0); r < static_cast<std::size_t>(r1); ++r) {
+                        const auto yc = domain.bottom + (static_cast<data::scalar_t>(r) + 0.5) * pixel_h;
+                        const auto x = p0.x + (yc - p0.y) * dxdy;
+                        left[r - first_row] = std::min(left[r - first_row], x);
+                        right[r - first_row] = std::max(right[r - first_row], x);
+                    }
+                }
+
+                he = he->next;
+            } while (he != face.half_edge);
+
+            const auto su = site.x - domain.left;
+            for (std::size_t i = 0; i < rows; ++i) {
+                const auto u0 = std::max(left[i], domain.left) - domain.left;
+                const auto u1 = std::min(right[i], domain.right) - domain.left;
+                if (!(u0 < u1))
+                    continue;
+
+                data::scalar_t i0, i1, i2;
+                table.integrate_row(first_row + i, u0, u1, i0, i1, i2);
+
+                const auto dy = domain.bottom + (static_cast<data::scalar_t>(first_row + i) + 0.5) * pixel_h - site.y;
+                moments.mass += pixel_h * i0;
+                moments.mx += pixel_h * (i1 - su * i0);
+                moments.my += pixel_h * i0 * dy;
+                moments.energy += pixel_h * (i2 - 2 * su * i1 + su * su * i0) + pixel_h * i0 * (dy * dy + pixel_h * pixel_h / 12);
+            }
+
+            return moments;
+        }
+
+        inline data::scalar_t dot(const std::vector<data::point_t>& a, const std::vector<data::point_t>& b) {
+            data::scalar_t sum = 0;
+            for (std::size_t i = 0; i < a.size(); ++i)
+                sum += a[i].x * b[i].x + a[i].y * b[i].y;
+            return sum;
+        }
+
+    } // namespace _details
+
+    // centroidal Voronoi tessellations against a density: every evaluation generates the diagram clipped to the
+    // density's domain with algorithm_t, then integrates the density over the cells in parallel
+    template<typename algorithm_t = sweep_hull::algorithm>
+    class solver_t {
+    public:
+        explicit solver_t(const density_t& density) : _table(density) {
+            assert(density.width > 0 && density.height > 0 && density.values.size() == density.width * density.height);
+            for (auto rho : density.values)
+                _total_mass += rho;
+            _total_mass *= _table.pixel_w() * _table.pixel_h();
+        }
+
+        [[nodiscard]] auto evaluate(const std::vector<data::point_t>& sites, std::size_t threads = 0) const -> evaluation_t {
+            const auto& domain = _table.density().domain;
+            auto diagram = algorithm_t::generate(sites, typename algorithm_t::config_t{ domain, true });
+
+            const auto n = sites.size();
+            evaluation_t evaluation;
+            evaluation.mass.resize(n);
+            evaluation.centroid.resize(n);
+            evaluation.gradient.resize(n);
+
+            std::mutex merge;
+            parallel::parallel_for_chunks(n, [&](std::size_t begin, std::size_t end) {
+                std::vector<data::scalar_t> left, right;
+                data::scalar_t energy = 0;
+
+                for (auto i = begin; i < end; ++i) {
+                    const auto moments = _details::integrate_cell(diagram->faces[i], _table, left, right);
+                    energy += moments.energy;
+                    evaluation.mass[i] = moments.mass;
+                    evaluation.centroid[i] = moments.mass > 0 ? sites[i] + data::point_t{ moments.mx / moments.mass, moments.my / moments.mass } : sites[i];
+                    evaluation.gradient[i] = { -2 * moments.mx, -2 * moments.my };
+                }
+
+                std::scoped_lock lock(merge);
+                evaluation.energy += energy;
+            }, threads, 256);
+
+            return evaluation;
+        }
+
+        [[nodiscard]] auto solve(std::vector<data::point_t> sites, const options_t& options = options_t{}) const -> result_t {
+            const auto& domain = _table.density().domain;
+            const auto scale = std::max(domain.right - domain.left, domain.top - domain.bottom);
+            const auto n = sites.size();
+
+            auto project = [&domain](data::point_t p) {
+                return data::point_t{ std::clamp(p.x, domain.left, domain.right), std::clamp(p.y, domain.bottom, domain.top) };
+            };
+
+            result_t result;
+            auto current = evaluate(sites, options.threads);
+
+            // L-BFGS correction pairs, site moves and gradient changes
+            std::deque<std::pair<std::vector<data::point_t>, std::vector<data::point_t>>> corrections;
+            std::vector<data::point_t> direction(n), next(n);
+
+            for (std::size_t k = 0; k < options.iterations; ++k) {
+                const auto started = std::chrono::steady_clock::now();
+
+                iteration_t iteration;
+                iteration.energy = current.energy;
+                iteration.gradient_norm = std::sqrt(_details::dot(current.gradient, current.gradient));
+
+                if (iteration.gradient_norm <= options.tolerance * _total_mass * scale) {
+                    result.converged = true;
+                    break;
+                }
+
+                bool accepted = false;
+                evaluation_t candidate;
+
+                if (options.method == method_t::lbfgs) {
+                    // two loop recursion, the initial inverse Hessian being Lloyd's 1 / (2 * mass) per site
+                    direction = current.gradient;
+                    std::vector<data::scalar_t> alpha(corrections.size());
+                    for (std::size_t j = corrections.size(); j-- > 0;) {
+                        const auto& [s, y] = corrections[j];
+                        alpha[j] = _details::dot(s, direction) / _details::dot(y, s);
+                        for (std::size_t i = 0; i < n; ++i)
+                            direction[i] = direction[i] - y[i] * alpha[j];
+                    }
+                    for (std::size_t i = 0; i < n; ++i)
+                        direction[i] = current.mass[i] > 0 ? direction[i] * (0.5 / current.mass[i]) : data::point_t{};
+                    for (std::size_t j = 0; j < corrections.size(); ++j) {
+                        const auto& [s, y] = corrections[j];
+                        const auto beta = _details::dot(y, direction) / _details::dot(y, s);
+                        for (std::size_t i = 0; i < n; ++i)
+                            direction[i] = direction[i] + s[i] * (alpha[j] - beta);
+                    }
+
+                    // backtracking on the energy, with the Armijo condition over the projected step
+                    for (data::scalar_t step = 1; step > 1.0 / 16 && !accepted; step /= 2) {
+                        for (std::size_t i = 0; i < n; ++i)
+                            next[i] = project(sites[i] - direction[i] * step);
+
+                        candidate = evaluate(next, options.threads);
+                        ++iteration.evaluations;
+
+                        data::scalar_t decrease = 0;
+                        for (std::size_t i = 0; i < n; ++i)
+                            decrease += current.gradient[i].x * (next[i].x - sites[i].x) + current.gradient[i].y * (next[i].y - sites[i].y);
+                        accepted = decrease < 0 && candidate.energy <= current.energy + 1e-4 * decrease;
+                    }
+
+                    if (accepted) {
+                        std::vector<data::point_t> s(n), y(n);
+                        for (std::size_t i = 0; i < n; ++i) {
+                            s[i] = next[i] - sites[i];
+                            y[i] = candidate.gradient[i] - current.gradient[i];
+                        }
+                        if (_details::dot(y, s) > std::numeric_limits<data::scalar_t>::epsilon() * _details::dot(y, y)) {
+                            corrections.emplace_back(std::move(s), std::move(y));
+                            if (corrections.size() > options.history)
+                                corrections.pop_front();
+                        }
+                    } else {
+                        corrections.clear();
+                    }
+                }
+
+                if (!accepted) {
+                    for (std::size_t i = 0; i < n; ++i)
+                        next[i] = project(current.centroid[i]);
+                    candidate = evaluate(next, options.threads);
+                    ++iteration.evaluations;
+                }
+
+                std::swap(sites, next);
+                current = std::move(candidate);
+                iteration.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+                result.iterations.push_back(iteration);
+            }
+
+            result.sites = std::move(sites);
+            return result;
+        }
+
+    private:
+        _details::density_table_t _table;
+        data::scalar_t _total_mass{};
+    };
+
+} // namespace dvoronoi::cvt
+
+#endif //DVORONOI_CVT_SOLVER_HPP
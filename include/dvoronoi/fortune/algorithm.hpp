@@ -8,13 +8,19 @@
 #include <vector>
 //#include <generator>
 #include <cassert>
+#include <algorithm>
 
 #include "dvoronoi/common/diagram.hpp"
 #include "dvoronoi/common/priority_queue.hpp"
 #include "dvoronoi/common/clipping.hpp"
 #include "dvoronoi/common/pair_hash.hpp"
+#include "dvoronoi/common/reorder.hpp"
+#include "dvoronoi/common/merge.hpp"
 
 #include "details.hpp"
+#include "workspace.hpp"
+#include "stats.hpp"
+#include "periodic.hpp"
 
 namespace dvoronoi::fortune {
 
@@ -22,53 +28,145 @@ class algorithm {
 public:
     typedef voronoi_diagram_t diagram_t;
     using voronoi_diagram_h = std::unique_ptr<diagram_t>;
-    typedef delaunay_diagram_t delaunay_diagram_t;
+    typedef dvoronoi::delaunay_diagram_t delaunay_diagram_t;
     using delaunay_diagram_h = std::unique_ptr<delaunay_diagram_t>;
 
     static auto generate(const auto& sites, const config_t& config = config_t{}) {
+        workspace_t workspace;
+        return generate(sites, config, workspace);
+    }
+
+    // adds the run's counters and phase times to stats
+    static auto generate(const auto& sites, const config_t& config, run_stats_t& stats) {
+        instrumented_workspace_t workspace;
+        return generate(sites, config, workspace, stats);
+    }
+
+    template<bool instrumented, template<typename, bool> typename ordered_t>
+    static auto generate(const auto& sites, const config_t& config, basic_workspace_t<instrumented, ordered_t>& workspace) -> voronoi_diagram_h {
+        no_stats_t stats;
+        return generate(sites, config, workspace, stats);
+    }
+
+    // stats is a run_stats_t, a beach_line_trace_t or a no_stats_t, whose empty hooks leave no trace in the sweep. A
+    // periodic run counts the sweeps of its extended diagrams
+    template<bool instrumented, template<typename, bool> typename ordered_t>
+    static auto generate(const auto& sites, const config_t& config, basic_workspace_t<instrumented, ordered_t>& workspace, auto& stats) -> voronoi_diagram_h {
         assert(!sites.empty());
 
-        auto diagram = std::make_unique<diagram_t>(sites.size());
+        if (config.merge_tolerance.has_value()) {
+            auto started = stats.start();
+            auto merged = merge_sites(sites, config.merge_tolerance.value());
+            stats.stop(phase_t::merge, started);
+
+            auto unmerged = config;
+            unmerged.merge_tolerance.reset();
+            auto diagram = generate(merged.points, unmerged, workspace, stats);
+            diagram->input_faces = std::make_unique<diagram_t::input_faces_t>(std::move(merged.representative));
+            return diagram;
+        }
 
-        priority_queue_t<_details::event_t<diag_traits>> event_queue(sites.size());
+        if (config.periodic.has_value()) {
+            auto diagram = _details::generate_periodic<voronoi_diagram_h>(sites, config.periodic.value(), [&workspace, &stats](const auto& extended, const box_t& region) {
+                return generate(extended, config_t{ region }, workspace, stats);
+            }, workspace.diagram_resource);
+
+            if (config.face_major) {
+                auto started = stats.start();
+                compact_rings(*diagram);
+                stats.stop(phase_t::layout, started);
+            }
+            return diagram;
+        }
+
+        auto started = stats.start();
+        auto diagram = std::make_unique<diagram_t>(sites.size(), workspace.diagram_resource);
+
+        workspace.reset(sites.size());
+        auto& event_queue = workspace.event_queue;
+        auto& beach_line = workspace.beach_line;
+
+        auto& site_order = workspace.site_order;
+        site_order.resize(sites.size());
 
         for (std::size_t i = 0; i < sites.size(); ++i) {
             diagram->sites.emplace_back(i, sites[i].x, sites[i].y);
             diagram->faces.emplace_back(&diagram->sites.back());
             diagram->sites.back().face = &diagram->faces.back();
-
-            event_queue.emplace(&diagram->sites.back());
+            site_order[i] = i;
         }
 
-        _details::beach_line_t<diag_traits> beach_line;
-
-        {
-            auto first_site_event = event_queue.pop();
-            beach_line.set_root(first_site_event->site);
-        }
+        // site events are taken in sweep order straight from the sorted indices, only circle events go through the queue
+        std::ranges::sort(site_order, [&diagram](std::size_t a, std::size_t b) {
+            const auto& pa = diagram->sites[a].point;
+            const auto& pb = diagram->sites[b].point;
+            return pb.y < pa.y || (pb.y == pa.y && pb.x < pa.x);
+        });
+        stats.stop(phase_t::queue_build, started);
+
+        started = stats.start();
+        stats.begin_sweep();
+        beach_line.set_root(&diagram->sites[site_order[0]]);
+        stats.top_site_event(beach_line.leftmost_arc());
+
+        std::size_t next_site = 1;
+        const auto top_y = diagram->sites[site_order[0]].point.y;
+        while (next_site < site_order.size() && util::eq(diagram->sites[site_order[next_site]].point.y, top_y))
+            _details::handle_top_site_event(&diagram->sites[site_order[next_site++]], beach_line, *diagram, stats);
+        workspace.top_edges = next_site - 1;
+
+        while (next_site < site_order.size() || !event_queue.empty()) {
+            if (next_site < site_order.size()) {
+                auto site_event = _details::event_t<diag_traits>(&diagram->sites[site_order[next_site]]);
+
+                if (event_queue.empty() || !(site_event < event_queue.top())) {
+                    ++next_site;
+                    handle_site_event(site_event, beach_line, *diagram, event_queue, stats);
+                    continue;
+                }
+            }
 
-        while (!event_queue.empty()) {
             auto event = event_queue.pop();
-
-            if (event->type == _details::event_type::site)
-                handle_site_event(*event, beach_line, *diagram, event_queue);
-            else
-                handle_circle_event(*event, beach_line, *diagram, event_queue);
+            handle_circle_event(*event, beach_line, *diagram, event_queue, stats);
+            event_queue.recycle(std::move(event));
         }
+        stats.rotated(beach_line.rotations());
+        stats.stop(phase_t::sweep, started);
 
         if (config.bounding_box.has_value()) {
-            bound(*diagram, config.bounding_box.value(), beach_line);
-            if (config.clip)
+            started = stats.start();
+            bound(*diagram, config.bounding_box.value(), workspace);
+            stats.stop(phase_t::bound, started);
+
+            if (config.clip) {
+                started = stats.start();
                 clip(*diagram, config.bounding_box.value());
+                stats.stop(phase_t::clip, started);
+            }
         }
 
+        if (config.face_major) {
+            started = stats.start();
+            compact_rings(*diagram);
+            stats.stop(phase_t::layout, started);
+        }
+
+        stats.produced(diagram->vertices.size(), diagram->half_edges.size());
         return diagram;
     }
 
+    // bounds the diagram of the last generate call made with workspace and no bounding box, from the beach line the
+    // workspace still holds; lets the sweep and the bounding be run, and timed, separately
+    template<bool instrumented, template<typename, bool> typename ordered_t>
+    static bool bound(auto& diag, const box_t& box, basic_workspace_t<instrumented, ordered_t>& workspace) {
+        return _details::bound(diag, box, workspace.beach_line, workspace.top_edges);
+    }
+
     static bool clip(auto& diag, const box_t& box) { return voronoi::clip(diag, box); }
+    static bool clip(auto& diag, const convex_polygon_t& polygon, std::size_t threads = 0) { return voronoi::clip(diag, polygon, threads); }
 
-    static auto generate_delaunay(const voronoi_diagram_h& voronoi_diagram) {
-        auto diagram = std::make_unique<delaunay_diagram_t>(voronoi_diagram->sites.size());
+    static auto generate_delaunay(const voronoi_diagram_h& voronoi_diagram, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+        auto diagram = std::make_unique<delaunay_diagram_t>(voronoi_diagram->sites.size(), resource);
 
         std::unordered_set<std::size_t> created_triangles;
         std::unordered_map<std::size_t, std::size_t> created_vertices;
@@ -138,6 +236,14 @@ public:
 
         return diagram;
     }
+
+    // adds the conversion time to stats
+    static auto generate_delaunay(const voronoi_diagram_h& voronoi_diagram, run_stats_t& stats) {
+        auto started = stats.start();
+        auto diagram = generate_delaunay(voronoi_diagram);
+        stats.stop(phase_t::delaunay, started);
+        return diagram;
+    }
 };
 
 //template<typename point_t>
@@ -5,28 +5,20 @@
 #ifndef DVORONOI_ARC_TREE_HPP
 #define DVORONOI_ARC_TREE_HPP
 
-//#define BL_USE_PMR
-#ifdef BL_USE_PMR
-#include "tracing_resource.hpp"
-#endif
+#include <memory_resource>
 
 namespace dvoronoi::fortune::_details {
 
-    template<typename arc_t>
+    // counted keeps the number of rotations, for run_stats_t; otherwise the counter is never touched
+    template<typename arc_t, bool counted = false>
     class arc_tree_t {
     protected:
-#ifdef BL_USE_PMR
-        using allocator_type = std::pmr::polymorphic_allocator<>;
-        //memory_management::tracing_resource _tracing_res{"beach_line"};
-        std::pmr::monotonic_buffer_resource _res{/*&_tracing_res*/};
-        std::pmr::unsynchronized_pool_resource _pool{&_res};
-        allocator_type _allocator{&_pool};
-        // std::size_t allocations;
-        // std::size_t max_allocations;
-#endif
+        std::pmr::polymorphic_allocator<arc_t> _allocator;
 
+        arc_t* _spare = nullptr; // deleted arcs, linked through next and reused by new_arc
         arc_t* _nil;
         arc_t* _root;
+        std::size_t _rotations{0};
 
         void free(arc_t* arc) {
             if (is_nil(arc))
@@ -38,27 +30,38 @@ namespace dvoronoi::fortune::_details {
             delete_arc(arc);
         }
 
+        void free_spare() {
+            while (_spare != nullptr) {
+                auto next = _spare->next;
+                destroy_arc(_spare);
+                _spare = next;
+            }
+        }
+
         template<typename... Args>
         arc_t* new_arc(Args&&... args) {
-            // ++this->allocations;
-            // this->max_allocations = std::max(this->allocations, this->max_allocations);
-#ifdef BL_USE_PMR
-            return _allocator.new_object<arc_t>(std::forward<Args>(args)...);
-#else
-            return new arc_t { std::forward<Args>(args)... };
-#endif
+            if (_spare != nullptr) {
+                auto arc = _spare;
+                _spare = arc->next;
+                *arc = arc_t{ std::forward<Args>(args)... };
+                return arc;
+            }
+
+            auto arc = _allocator.allocate(1);
+            return new (arc) arc_t{ std::forward<Args>(args)... };
         }
         
         void delete_arc(arc_t* arc) {
-#ifdef BL_USE_PMR
-            _allocator.delete_object(arc);
-#else
-            delete arc;
-#endif
-            // --allocations;
+            arc->next = _spare;
+            _spare = arc;
+        }
+
+        void destroy_arc(arc_t* arc) {
+            arc->~arc_t();
+            _allocator.deallocate(arc, 1);
         }
 
-        arc_tree_t() : /*allocations(1), max_allocations(1), */_nil(new_arc()), _root(_nil) {}
+        explicit arc_tree_t(std::pmr::memory_resource* resource) : _allocator(resource), _nil(new_arc()), _root(_nil) {}
 
         bool is_nil(const arc_t* arc) const { return arc == _nil; }
 
@@ -275,6 +278,8 @@ namespace dvoronoi::fortune::_details {
         }
 
         void left_rotate(arc_t* x) {
+            if constexpr (counted)
+                ++_rotations;
             auto y = x->right;
             x->right = y->left;
             if (!is_nil(y->left))
@@ -291,6 +296,8 @@ namespace dvoronoi::fortune::_details {
         }
 
         void right_rotate(arc_t* y) {
+            if constexpr (counted)
+                ++_rotations;
             auto x = y->left;
             y->left = x->right;
             if (!is_nil(x->right))
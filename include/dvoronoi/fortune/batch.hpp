@@ -0,0 +1,43 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_BATCH_HPP
+#define DVORONOI_BATCH_HPP
+
+#include <vector>
+
+#include "dvoronoi/common/thread_pool.hpp"
+
+#include "algorithm.hpp"
+#include "workspace.hpp"
+
+namespace dvoronoi::fortune {
+
+    // generates many independent diagrams over a work stealing pool; the pool and one workspace per worker
+    // live as long as the batch_t, so keeping it around between requests avoids re-creating them
+    class batch_t {
+    public:
+        explicit batch_t(std::size_t threads = 0) : _pool(threads), _workspaces(_pool.size()) {}
+
+        [[nodiscard]] std::size_t threads() const { return _pool.size(); }
+
+        // diagrams are returned in the order of the site sets
+        auto generate(const auto& site_sets, const config_t& config = config_t{}) -> std::vector<algorithm::voronoi_diagram_h> {
+            std::vector<algorithm::voronoi_diagram_h> diagrams(site_sets.size());
+
+            _pool.for_each(site_sets.size(), [this, &site_sets, &config, &diagrams](std::size_t worker, std::size_t i) {
+                diagrams[i] = algorithm::generate(site_sets[i], config, _workspaces[worker]);
+            });
+
+            return diagrams;
+        }
+
+    private:
+        parallel::thread_pool_t _pool;
+        std::vector<workspace_t> _workspaces;
+    };
+
+} // namespace dvoronoi::fortune
+
+#endif //DVORONOI_BATCH_HPP
@@ -7,22 +7,26 @@
 
 #include "dvoronoi/common/util.hpp"
 #include "arc_tree.hpp"
+#include "treap_arc_tree.hpp"
 #include "arc.hpp"
 
 namespace dvoronoi::fortune::_details {
 
-    template<typename diag_traits>
-    class beach_line_t : private arc_tree_t<data::arc_t<diag_traits>> {
+    // ordered_t is the structure keeping the arcs in order, arc_tree_t or treap_arc_tree_t
+    template<typename diag_traits, bool counted = false, template<typename, bool> typename ordered_t = arc_tree_t>
+    class beach_line_t : private ordered_t<data::arc_t<diag_traits>, counted> {
+        typedef ordered_t<data::arc_t<diag_traits>, counted> tree_t;
+
     public:
         typedef data::arc_t<diag_traits> arc_t;
         typedef diag_traits::scalar_t scalar_t;
         typedef diag_traits::site_t site_t;
 
-        beach_line_t() : arc_tree_t<arc_t>() {}
+        explicit beach_line_t(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) : tree_t(resource) {}
         ~beach_line_t() {
-            arc_tree_t<arc_t>::free(this->_root);
-            arc_tree_t<arc_t>::delete_arc(this->_nil);
-            // std::cout << "[bl::dtor]: " << this->allocations << ", max: " << this->max_allocations << std::endl;;
+            tree_t::free(this->_root);
+            tree_t::free_spare();
+            tree_t::destroy_arc(this->_nil);
         }
 
         beach_line_t(const beach_line_t&) = delete;
@@ -30,7 +34,17 @@ namespace dvoronoi::fortune::_details {
         beach_line_t& operator=(const beach_line_t&) = delete;
 
         [[nodiscard]] bool empty() const { return is_nil(this->_root); }
-        bool is_nil(const arc_t* arc) const { return arc_tree_t<arc_t>::is_nil(arc); }
+        bool is_nil(const arc_t* arc) const { return tree_t::is_nil(arc); }
+
+        // the arcs are kept for the next sweep
+        void clear() {
+            tree_t::free(this->_root);
+            this->_root = this->_nil;
+            this->_rotations = 0;
+        }
+
+        // rebalancing rotations since the last clear, always 0 unless counted
+        [[nodiscard]] std::size_t rotations() const { return this->_rotations; }
 
         void set_root(site_t* site) {
             this->_root = create_arc(site, arc_t::side_t::Left);
@@ -40,8 +54,15 @@ namespace dvoronoi::fortune::_details {
         auto arc_above(const auto& point, auto sweep_y) const;
         auto break_arc(arc_t* arc, site_t* site);
 
-        void remove(arc_t* arc) { arc_tree_t<arc_t>::remove(arc); }
-        void delete_arc(arc_t* arc) { arc_tree_t<arc_t>::delete_arc(arc); }
+        void remove(arc_t* arc) { tree_t::remove(arc); }
+        void delete_arc(arc_t* arc) { tree_t::delete_arc(arc); }
+
+        // sites level with the first one have no parabola above them, they come in decreasing x and line up leftwards
+        arc_t* add_leftmost(site_t* site) {
+            auto arc = create_arc(site, arc_t::side_t::Left);
+            insert_before(leftmost_arc(), arc);
+            return arc;
+        }
 
         arc_t* leftmost_arc() const {
             auto x = this->_root;
@@ -51,19 +72,19 @@ namespace dvoronoi::fortune::_details {
         }
 
     private:
-        void replace(arc_t* arc, arc_t* other) { arc_tree_t<arc_t>::replace(arc, other); }
-        void insert_before(arc_t* before, arc_t* arc) { arc_tree_t<arc_t>::insert_before(before, arc); }
-        void insert_after(arc_t* after, arc_t* arc) { arc_tree_t<arc_t>::insert_after(after, arc); }
+        void replace(arc_t* arc, arc_t* other) { tree_t::replace(arc, other); }
+        void insert_before(arc_t* before, arc_t* arc) { tree_t::insert_before(before, arc); }
+        void insert_after(arc_t* after, arc_t* arc) { tree_t::insert_after(after, arc); }
 
         arc_t* create_arc(site_t* site, typename arc_t::side_t side) {
-            return arc_tree_t<arc_t>::new_arc(this->_nil, this->_nil, this->_nil, this->_nil, this->_nil, site, nullptr, nullptr, nullptr, arc_t::color_t::Red, side);
+            return tree_t::new_arc(this->_nil, this->_nil, this->_nil, this->_nil, this->_nil, site, nullptr, nullptr, nullptr, arc_t::color_t::Red, side);
         }
 
         auto compute_breakpoint(const auto& p1, const auto& p2, auto sweep_y, typename arc_t::side_t side) const;
     };
 
-    template<typename diag_traits>
-    auto beach_line_t<diag_traits>::arc_above(const auto& point, auto sweep_y) const {
+    template<typename diag_traits, bool counted, template<typename, bool> typename ordered_t>
+    auto beach_line_t<diag_traits, counted, ordered_t>::arc_above(const auto& point, auto sweep_y) const {
         auto node = this->_root;
         bool found = false;
 
@@ -87,8 +108,8 @@ namespace dvoronoi::fortune::_details {
         return node;
     }
 
-    template<typename diag_traits>
-    auto beach_line_t<diag_traits>::break_arc(arc_t* arc, site_t* site) {
+    template<typename diag_traits, bool counted, template<typename, bool> typename ordered_t>
+    auto beach_line_t<diag_traits, counted, ordered_t>::break_arc(arc_t* arc, site_t* site) {
         auto middle_arc = create_arc(site, arc_t::side_t::Left);
 
         auto left_arc = create_arc(arc->site, arc_t::side_t::Left);
@@ -101,13 +122,13 @@ namespace dvoronoi::fortune::_details {
         insert_before(middle_arc, left_arc);
         insert_after(middle_arc, right_arc);
 
-        arc_tree_t<arc_t>::delete_arc(arc);
+        tree_t::delete_arc(arc);
 
         return middle_arc;
     }
 
-    template<typename diag_traits>
-    auto beach_line_t<diag_traits>::compute_breakpoint(const auto& p1, const auto& p2, auto sweep_y, typename arc_t::side_t side) const {
+    template<typename diag_traits, bool counted, template<typename, bool> typename ordered_t>
+    auto beach_line_t<diag_traits, counted, ordered_t>::compute_breakpoint(const auto& p1, const auto& p2, auto sweep_y, typename arc_t::side_t side) const {
         auto x1 = p1.x, y1 = p1.y, x2 = p2.x, y2 = p2.y;
 
         if (util::eq(y1, y2)) {
@@ -6,22 +6,67 @@
 #define DVORONOI_BOUND_HPP
 
 #include <array>
+#include <limits>
 #include <unordered_map>
 
 #include "dvoronoi/common/diagram.hpp"
 
 namespace dvoronoi::fortune::_details {
 
+    constexpr std::size_t no_index = std::numeric_limits<std::size_t>::max();
+
+    // indices rather than pointers, the diagram's arrays may grow, and move, while bounding
     struct linked_vertex_t {
-        dvoronoi::data::half_edge_t* prev_half_edge = nullptr;
-        dvoronoi::data::vertex_t* vertex = nullptr;
-        dvoronoi::data::half_edge_t* next_half_edge = nullptr;
+        std::size_t prev_half_edge = no_index;
+        std::size_t vertex = no_index;
+        std::size_t next_half_edge = no_index;
     };
 
+    // inputs in general position fit in the diagram's reservation, degenerate ones can need more
+    auto* create_bound_vertex(auto& diag, const dvoronoi::data::point_t& point) {
+        if (diag.vertices.size() == diag.vertices.capacity())
+            diag.reserve_vertices(2 * diag.vertices.capacity());
+        return diag.create_vertex(point);
+    }
+
+    auto* create_bound_corner(auto& diag, const box_t& box, std::size_t side) {
+        if (diag.vertices.size() == diag.vertices.capacity())
+            diag.reserve_vertices(2 * diag.vertices.capacity());
+        return diag.create_corner(box, side);
+    }
+
     using linked_vertices_t = std::list<linked_vertex_t>;
     using vertices_t = std::unordered_map<std::size_t, std::array<linked_vertex_t*, 8>> ;
 
-    bool bound(auto& diag, box_t box, auto& beach_line) {
+    bool bound_top_edge(const auto& box, auto* left_half_edge, auto& linked_vertices, auto& vertices, auto& diag) {
+        bool success = true;
+
+        auto right_half_edge = left_half_edge->twin;
+        const auto& left_site = *left_half_edge->face->site;
+        const auto& right_site = *right_half_edge->face->site;
+
+        auto vertex = create_bound_vertex(diag, { (left_site.point.x + right_site.point.x) * 0.5, box.top });
+        left_half_edge->dest = vertex;
+        right_half_edge->orig = vertex;
+
+        if (vertices.find(left_site.index) == vertices.end())
+            vertices[left_site.index].fill(nullptr);
+        if (vertices.find(right_site.index) == vertices.end())
+            vertices[right_site.index].fill(nullptr);
+
+        success = vertices[left_site.index][2 * box_side::Top] == nullptr && success;
+        success = vertices[right_site.index][2 * box_side::Top + 1] == nullptr && success;
+
+        linked_vertices.emplace_back(left_half_edge->index, vertex->index, no_index);
+        vertices[left_site.index][2 * box_side::Top] = &linked_vertices.back();
+        linked_vertices.emplace_back(no_index, vertex->index, right_half_edge->index);
+        vertices[right_site.index][2 * box_side::Top + 1] = &linked_vertices.back();
+
+        return success;
+    }
+
+    // the first top_edges pairs of half edges separate the topmost sites, they are open upwards
+    bool bound(auto& diag, box_t box, auto& beach_line, std::size_t top_edges = 0) {
         bool all_bounded = true;
 
         for (const auto& vertex : diag.vertices) {
@@ -34,6 +79,9 @@ namespace dvoronoi::fortune::_details {
         linked_vertices_t linked_vertices;
         vertices_t vertices;
 
+        for (std::size_t i = 0; i < top_edges; ++i)
+            all_bounded = bound_top_edge(box, &diag.half_edges[2 * i], linked_vertices, vertices, diag) && all_bounded;
+
         if (!beach_line.empty()) {
             auto arc = beach_line.leftmost_arc();
             while (!beach_line.is_nil(arc->next)) {
@@ -103,7 +151,7 @@ namespace dvoronoi::fortune::_details {
         auto origin = (left_arc->site->point + right_arc->site->point) * 0.5;
         auto intersection = first_intersection(box, origin, direction);
 
-        auto vertex = diag.create_vertex(intersection.point);
+        auto vertex = create_bound_vertex(diag, intersection.point);
         set_dest(left_arc, right_arc, vertex);
 
         if (vertices.find(left_arc->site->index) == vertices.end())
@@ -114,9 +162,9 @@ namespace dvoronoi::fortune::_details {
         success = vertices[left_arc->site->index][2 * intersection.side + 1] == nullptr && success;
         success = vertices[right_arc->site->index][2 * intersection.side] == nullptr && success;
 
-        linked_vertices.emplace_back(nullptr, vertex, left_arc->right_half_edge);
+        linked_vertices.emplace_back(no_index, vertex->index, left_arc->right_half_edge->index);
         vertices[left_arc->site->index][2 * intersection.side + 1] = &linked_vertices.back();
-        linked_vertices.emplace_back(right_arc->left_half_edge, vertex, nullptr);
+        linked_vertices.emplace_back(right_arc->left_half_edge->index, vertex->index, no_index);
         vertices[right_arc->site->index][2 * intersection.side] = &linked_vertices.back();
 
         return success;
@@ -129,8 +177,8 @@ namespace dvoronoi::fortune::_details {
             std::size_t side = i % 4;
 
             if (cell_vertices[2 * side] == nullptr && cell_vertices[2 * side + 1] != nullptr) {
-                auto corner = diag.create_corner(box, side);
-                linked_vertices.emplace_back(nullptr, corner, nullptr);
+                auto corner = create_bound_corner(diag, box, side);
+                linked_vertices.emplace_back(no_index, corner->index, no_index);
 
                 auto prev_side = (side + 3) % 4;
                 success = cell_vertices[2 * prev_side + 1] == nullptr && success;
@@ -140,8 +188,8 @@ namespace dvoronoi::fortune::_details {
             } else if (cell_vertices[2 * side] != nullptr && cell_vertices[2 * side + 1] == nullptr) {
                 std::size_t next_side = (side + 1) % 4;
 
-                auto corner = diag.create_corner(box, next_side);
-                linked_vertices.emplace_back(nullptr, corner, nullptr);
+                auto corner = create_bound_corner(diag, box, next_side);
+                linked_vertices.emplace_back(no_index, corner->index, no_index);
 
                 success = cell_vertices[2 * next_side] == nullptr && success;
 
@@ -158,17 +206,25 @@ namespace dvoronoi::fortune::_details {
             if (cell_vertices[2 * side] == nullptr)
                 continue;
 
+            if (diag.half_edges.size() == diag.half_edges.capacity())
+                diag.reserve_half_edges(2 * diag.half_edges.capacity());
+
+            auto& from = *cell_vertices[2 * side];
+            auto& to = *cell_vertices[2 * side + 1];
+
             auto half_edge = diag.create_half_edge(&diag.faces[i]);
-            half_edge->orig = cell_vertices[2 * side]->vertex;
-            half_edge->dest = cell_vertices[2 * side + 1]->vertex;
-            cell_vertices[2 * side]->next_half_edge = half_edge;
-            half_edge->prev = cell_vertices[2 * side]->prev_half_edge;
-            if (cell_vertices[2 * side]->prev_half_edge != nullptr)
-                cell_vertices[2 * side]->prev_half_edge->next = half_edge;
-            cell_vertices[2 * side + 1]->prev_half_edge = half_edge;
-            half_edge->next = cell_vertices[2 * side + 1]->next_half_edge;
-            if (cell_vertices[2 * side + 1]->next_half_edge != nullptr)
-                cell_vertices[2 * side + 1]->next_half_edge->prev = half_edge;
+            half_edge->orig = &diag.vertices[from.vertex];
+            half_edge->dest = &diag.vertices[to.vertex];
+            from.next_half_edge = half_edge->index;
+            if (from.prev_half_edge != no_index) {
+                half_edge->prev = &diag.half_edges[from.prev_half_edge];
+                half_edge->prev->next = half_edge;
+            }
+            to.prev_half_edge = half_edge->index;
+            if (to.next_half_edge != no_index) {
+                half_edge->next = &diag.half_edges[to.next_half_edge];
+                half_edge->next->prev = half_edge;
+            }
         }
     }
 
@@ -7,6 +7,7 @@
 
 #include <optional>
 
+#include "dvoronoi/common/data.hpp"
 #include "dvoronoi/common/box.hpp"
 
 namespace dvoronoi::fortune {
@@ -14,6 +15,15 @@ namespace dvoronoi::fortune {
     struct config_t {
         std::optional<box_t> bounding_box{};
         bool clip{false};
+        // when set, the diagram is built on the torus obtained by gluing the opposite sides of this box: sites are
+        // wrapped into it, every edge has a twin, vertices are wrapped too (see unwrap), bounding_box and clip are ignored
+        std::optional<box_t> periodic{};
+        // when set, each face's half edges are laid out consecutively in ring order once the diagram is complete, see
+        // compact_rings
+        bool face_major{false};
+        // when set, sites within this distance of one another, 0 for exact duplicates only, are merged before
+        // generating, see merge_sites; each group gets a single face and the diagram's input_faces maps inputs to them
+        std::optional<data::scalar_t> merge_tolerance{};
     };
 
 }
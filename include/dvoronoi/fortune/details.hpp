@@ -38,7 +38,7 @@ namespace dvoronoi::fortune::_details {
     }
 
     template<typename event_t>
-    void maybe_add_circle_event(auto* left, auto* middle, auto* right, auto sweep_y, auto& event_queue) {
+    void maybe_add_circle_event(auto* left, auto* middle, auto* right, auto sweep_y, auto& event_queue, auto& stats) {
         const auto& p1 = left->site->point;
         const auto& p2 = middle->site->point;
         const auto& p3 = right->site->point;
@@ -74,22 +74,25 @@ namespace dvoronoi::fortune::_details {
             return;
 
         middle->event = event_queue.emplace(event_y, convergence_point.value(), middle);
+        stats.circle_event_created(event_queue.size());
     }
 
-    void invalidate_circle_event(auto* arc, auto& event_queue) {
+    void invalidate_circle_event(auto* arc, auto& event_queue, auto& stats) {
         if (!arc->event)
             return;
 
         event_queue.remove(arc->event->index);
         arc->event = nullptr;
+        stats.circle_event_invalidated();
     }
 
     template<typename event_t>
-    void handle_site_event(const event_t& event, auto& beach_line, auto& diagram, auto& event_queue) {
+    void handle_site_event(const event_t& event, auto& beach_line, auto& diagram, auto& event_queue, auto& stats) {
         auto arc_above = beach_line.arc_above(event.site->point, event.y);
-        invalidate_circle_event(arc_above, event_queue);
+        invalidate_circle_event(arc_above, event_queue, stats);
 
         auto middle_arc = beach_line.break_arc(arc_above, event.site);
+        stats.site_event(middle_arc);
         auto left_arc = middle_arc->prev;
         auto right_arc = middle_arc->next;
 
@@ -98,9 +101,17 @@ namespace dvoronoi::fortune::_details {
         right_arc->left_half_edge = left_arc->right_half_edge;
 
         if (!beach_line.is_nil(left_arc->prev))
-            maybe_add_circle_event<event_t>(left_arc->prev, left_arc, middle_arc, event.y, event_queue);
+            maybe_add_circle_event<event_t>(left_arc->prev, left_arc, middle_arc, event.y, event_queue, stats);
         if (!beach_line.is_nil(right_arc->next))
-            maybe_add_circle_event<event_t>(middle_arc, right_arc, right_arc->next, event.y, event_queue);
+            maybe_add_circle_event<event_t>(middle_arc, right_arc, right_arc->next, event.y, event_queue, stats);
+    }
+
+    // the arcs of the topmost sites are separated by vertical edges, without vertices until circle events close them
+    void handle_top_site_event(auto* site, auto& beach_line, auto& diagram, auto& stats) {
+        auto right_arc = beach_line.leftmost_arc();
+        auto left_arc = beach_line.add_leftmost(site);
+        stats.top_site_event(left_arc);
+        add_edge(left_arc, right_arc, diagram);
     }
 
     void remove_arc_and_update_diag(auto* arc, auto* vertex, auto& beach_line, auto& diagram) {
@@ -124,22 +135,24 @@ namespace dvoronoi::fortune::_details {
     }
 
     template<typename event_t>
-    void handle_circle_event(const event_t& event, auto& beach_line, auto& diagram, auto& event_queue) {
+    void handle_circle_event(const event_t& event, auto& beach_line, auto& diagram, auto& event_queue, auto& stats) {
+        stats.circle_event_handled(event.arc);
+
         auto vertex = diagram.create_vertex(event.convergence);
 
         auto arc = event.arc;
         auto left_arc = arc->prev;
         auto right_arc = arc->next;
 
-        invalidate_circle_event(left_arc, event_queue);
-        invalidate_circle_event(right_arc, event_queue);
+        invalidate_circle_event(left_arc, event_queue, stats);
+        invalidate_circle_event(right_arc, event_queue, stats);
 
         remove_arc_and_update_diag(arc, vertex, beach_line, diagram);
 
         if (!beach_line.is_nil(left_arc->prev))
-            maybe_add_circle_event<event_t>(left_arc->prev, left_arc, right_arc, event.y, event_queue);
+            maybe_add_circle_event<event_t>(left_arc->prev, left_arc, right_arc, event.y, event_queue, stats);
         if (!beach_line.is_nil(right_arc->next))
-            maybe_add_circle_event<event_t>(left_arc, right_arc, right_arc->next, event.y, event_queue);
+            maybe_add_circle_event<event_t>(left_arc, right_arc, right_arc->next, event.y, event_queue, stats);
     }
 
 } // namespace dvoronoi::fortune::_details
@@ -0,0 +1,64 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_MEMORY_HPP
+#define DVORONOI_MEMORY_HPP
+
+#include <iomanip>
+#include <ostream>
+#include <memory_resource>
+
+#include "dvoronoi/common/tracing_resource.hpp"
+
+#include "workspace.hpp"
+
+namespace dvoronoi::fortune {
+
+    // one tracing resource per structure, forwarding to upstream. A workspace built from resources() reports the
+    // event queue, beach line and site order of its sweeps and the arrays of the diagrams it returns. The diagrams
+    // free their arrays through it, so it must outlive them; not thread safe, use one per workspace.
+    class memory_accounting_t {
+    public:
+        typedef memory_management::memory_usage_t usage_t;
+
+        explicit memory_accounting_t(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : _event_queue("event queue", upstream), _beach_line("beach line", upstream)
+            , _site_order("site order", upstream), _diagram("diagram", upstream) {}
+
+        memory_accounting_t(const memory_accounting_t&) = delete;
+        memory_accounting_t& operator=(const memory_accounting_t&) = delete;
+
+        [[nodiscard]] memory_resources_t resources() { return { &_event_queue, &_beach_line, &_site_order, &_diagram }; }
+
+        [[nodiscard]] const usage_t& event_queue() const { return _event_queue.usage(); }
+        [[nodiscard]] const usage_t& beach_line() const { return _beach_line.usage(); }
+        [[nodiscard]] const usage_t& site_order() const { return _site_order.usage(); }
+        [[nodiscard]] const usage_t& diagram() const { return _diagram.usage(); }
+
+        void reset_peaks() {
+            for (auto* resource : { &_event_queue, &_beach_line, &_site_order, &_diagram })
+                resource->reset_peak();
+        }
+
+        // one line per structure: current and peak bytes, allocations and deallocations
+        void report(std::ostream& out) const {
+            out << std::left << std::setw(14) << "structure" << std::right << std::setw(14) << "current" << std::setw(14) << "peak"
+                << std::setw(14) << "allocations" << std::setw(16) << "deallocations" << '\n';
+            for (const auto* resource : { &_event_queue, &_beach_line, &_site_order, &_diagram }) {
+                const auto& usage = resource->usage();
+                out << std::left << std::setw(14) << resource->name() << std::right << std::setw(14) << usage.current_bytes
+                    << std::setw(14) << usage.peak_bytes << std::setw(14) << usage.allocations << std::setw(16) << usage.deallocations << '\n';
+            }
+        }
+
+    private:
+        memory_management::tracing_resource _event_queue;
+        memory_management::tracing_resource _beach_line;
+        memory_management::tracing_resource _site_order;
+        memory_management::tracing_resource _diagram;
+    };
+
+} // namespace dvoronoi::fortune
+
+#endif //DVORONOI_MEMORY_HPP
@@ -0,0 +1,37 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_PERF_STATS_HPP
+#define DVORONOI_PERF_STATS_HPP
+
+#include <array>
+
+#include "dvoronoi/common/perf_counters.hpp"
+
+#include "stats.hpp"
+
+namespace dvoronoi::fortune {
+
+    // performance counters per phase of the generate calls it is passed to as stats, added up over the calls. Only the
+    // phase boundaries read the counters, the sweep itself is left as with no_stats_t
+    class perf_stats_t : public no_stats_t {
+    public:
+        typedef perf::sample_t time_point_t;
+
+        explicit perf_stats_t(const perf::counters_t& counters) : _counters(counters) {}
+
+        [[nodiscard]] const perf::counters_t& counters() const { return _counters; }
+        [[nodiscard]] const perf::sample_t& phase(phase_t p) const { return _phases[static_cast<std::size_t>(p)]; }
+
+        [[nodiscard]] time_point_t start() const { return _counters.read(); }
+        void stop(phase_t p, const time_point_t& started) { _phases[static_cast<std::size_t>(p)] += _counters.read() - started; }
+
+    private:
+        const perf::counters_t& _counters;
+        std::array<perf::sample_t, static_cast<std::size_t>(phase_t::count)> _phases{};
+    };
+
+} // namespace dvoronoi::fortune
+
+#endif //DVORONOI_PERF_STATS_HPP
@@ -0,0 +1,232 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_PERIODIC_HPP
+#define DVORONOI_PERIODIC_HPP
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numbers>
+#include <memory_resource>
+#include <vector>
+#include <algorithm>
+
+#include "dvoronoi/common/diagram.hpp"
+
+#include "arc.hpp"
+
+namespace dvoronoi::fortune {
+
+    // the copy of p, moved by whole periods of the domain, nearest to reference; periodic diagrams store their
+    // vertices wrapped into the domain, so a cell crossing a side is drawn by unwrapping its vertices around its site.
+    // Only unambiguous for cells smaller than half the domain, which holds unless there are very few sites
+    inline dvoronoi::data::point_t unwrap(dvoronoi::data::point_t p, const dvoronoi::data::point_t& reference, const box_t& domain) {
+        const auto w = domain.right - domain.left;
+        const auto h = domain.top - domain.bottom;
+        p.x -= w * std::round((p.x - reference.x) / w);
+        p.y -= h * std::round((p.y - reference.y) / h);
+        return p;
+    }
+
+    namespace _details {
+
+        inline dvoronoi::data::scalar_t wrap(dvoronoi::data::scalar_t v, dvoronoi::data::scalar_t low, dvoronoi::data::scalar_t period) {
+            auto wrapped = std::fmod(v - low, period);
+            if (wrapped < 0)
+                wrapped += period;
+            return low + (wrapped >= period ? 0 : wrapped);
+        }
+
+        struct periodic_site_t {
+            std::size_t source; // input site index
+            int dx;             // offset in periods, -1, 0 or 1
+            int dy;
+        };
+
+        // offset code of a neighbouring copy, 4 is the domain itself
+        inline std::size_t offset_code(int dx, int dy) { return static_cast<std::size_t>((dx + 1) * 3 + (dy + 1)); }
+
+        // a half edge of a cell is resolved when it is linked and its origin's empty circle lies inside region, i.e. no
+        // site missing from the replicated band could have changed it
+        inline bool is_resolved(const dvoronoi::data::half_edge_t& he, const box_t& region) {
+            if (he.orig == nullptr || he.twin == nullptr || he.next == nullptr || he.prev == nullptr)
+                return false;
+
+            const auto& v = he.orig->point;
+            auto r = v.dist(he.face->site->point) * (1 + 1e-9);
+            return v.x - r >= region.left && v.x + r <= region.right && v.y - r >= region.bottom && v.y + r <= region.top;
+        }
+
+        // the input cells keep their extended diagram half edges, in the same order so the passes below are linear.
+        // The twin of the edge between input site i and the copy (s, dx, dy) is the edge between s and the copy
+        // (i, -dx, -dy), found among the few half edges of s. Unresolved cells, which only happens on lattice like
+        // inputs the sweep handles poorly, get no half edges.
+        template<typename diagram_h>
+        auto extract_periodic_cells(const auto& extended, const std::vector<bool>& resolved, const std::vector<periodic_site_t>& copies, const box_t& domain,
+                                    std::pmr::memory_resource* resource = std::pmr::get_default_resource()) -> diagram_h {
+            constexpr auto npos = std::numeric_limits<std::size_t>::max();
+
+            const auto n = resolved.size();
+            const auto w = domain.right - domain.left;
+            const auto h = domain.top - domain.bottom;
+
+            const auto* extended_faces = extended.faces.data();
+            const auto* extended_half_edges = extended.half_edges.data();
+
+            std::vector<std::size_t> new_index(extended.half_edges.size(), npos);
+            std::size_t half_edges_count = 0;
+            for (const auto& he : extended.half_edges) {
+                auto i = static_cast<std::size_t>(he.face - extended_faces);
+                if (i < n && resolved[i])
+                    new_index[he.index] = half_edges_count++;
+            }
+
+            auto diagram = std::make_unique<typename diagram_h::element_type>(n, resource);
+            diagram->half_edges.reserve(std::max(diagram->half_edges.capacity(), half_edges_count));
+            diagram->half_edges.resize(half_edges_count);
+            auto* half_edges = diagram->half_edges.data();
+
+            for (std::size_t i = 0; i < n; ++i) {
+                const auto& p = extended.sites[i].point;
+                diagram->sites.emplace_back(i, p.x, p.y);
+                diagram->faces.emplace_back(&diagram->sites.back());
+                diagram->sites.back().face = &diagram->faces.back();
+                if (resolved[i])
+                    diagram->faces[i].half_edge = half_edges + new_index[extended.faces[i].half_edge - extended_half_edges];
+            }
+
+            // half edges facing a copy are twinned below, the offset of that copy is kept for them
+            std::vector<periodic_site_t> neighbors(half_edges_count);
+
+            // orig pointers refer to the extended diagram's vertices at this point, they are replaced below
+            for (const auto& source : extended.half_edges) {
+                if (new_index[source.index] == npos)
+                    continue;
+
+                auto& he = half_edges[new_index[source.index]];
+                he.index = new_index[source.index];
+                he.face = &diagram->faces[source.face - extended_faces];
+                he.orig = source.orig;
+                he.next = half_edges + new_index[source.next->index];
+                he.prev = half_edges + new_index[source.prev->index];
+
+                auto neighbor = static_cast<std::size_t>(source.twin->face - extended_faces);
+                if (neighbor < n)
+                    he.twin = resolved[neighbor] ? half_edges + new_index[source.twin->index] : nullptr;
+                else
+                    neighbors[he.index] = copies[neighbor - n];
+            }
+
+            for (std::size_t k = 0; k < half_edges_count; ++k) {
+                auto& he = half_edges[k];
+                const auto& neighbor = neighbors[k];
+                if (he.twin != nullptr || (neighbor.dx == 0 && neighbor.dy == 0) || !resolved[neighbor.source])
+                    continue;
+
+                const auto i = static_cast<std::size_t>(he.face - diagram->faces.data());
+                auto first = diagram->faces[neighbor.source].half_edge;
+                auto other = first;
+                do {
+                    const auto& back = neighbors[other->index];
+                    if (back.source == i && back.dx == -neighbor.dx && back.dy == -neighbor.dy) {
+                        he.twin = other;
+                        other->twin = &he;
+                        break;
+                    }
+                    other = other->next;
+                } while (other != first);
+            }
+
+            // on the torus every edge has a twin, so rotating through twins visits all the half edges leaving a vertex
+            diagram->vertices.reserve(std::max(diagram->vertices.capacity(), half_edges_count));
+            std::vector<bool> assigned(half_edges_count, false);
+            for (auto& start : diagram->half_edges) {
+                if (assigned[start.index])
+                    continue;
+
+                auto p = start.orig->point;
+                auto vertex = diagram->create_vertex({ wrap(p.x, domain.left, w), wrap(p.y, domain.bottom, h) });
+
+                auto he = &start;
+                do {
+                    he->orig = vertex;
+                    assigned[he->index] = true;
+                    he = he->prev->twin;
+                } while (he != nullptr && he != &start);
+            }
+
+            for (auto& he : diagram->half_edges)
+                he.dest = he.next->orig;
+
+            return diagram;
+        }
+
+        // sites within margin of a side are copied to the opposite side, so only a band around the domain is replicated
+        // instead of the full 3 x 3 tiling. The margin doubles until every input cell is resolved, i.e. no vertex's empty
+        // circle reaches out of the replicated region, then the input cells are extracted with their wrapped twins.
+        template<typename diagram_h>
+        auto generate_periodic(const auto& sites, const box_t& domain, auto&& generate_bounded,
+                               std::pmr::memory_resource* resource = std::pmr::get_default_resource()) -> diagram_h {
+            const auto n = sites.size();
+            const auto w = domain.right - domain.left;
+            const auto h = domain.top - domain.bottom;
+
+            std::vector<dvoronoi::data::point_t> wrapped(n);
+            for (std::size_t i = 0; i < n; ++i)
+                wrapped[i] = { wrap(sites[i].x, domain.left, w), wrap(sites[i].y, domain.bottom, h) };
+
+            std::vector<dvoronoi::data::point_t> extended;
+            std::vector<periodic_site_t> copies;
+            std::vector<bool> resolved(n);
+            diagram_h diagram;
+
+            // for uniform sites the largest empty circle has a radius of about spacing * sqrt(ln(n) / pi), the vertices
+            // on the domain's sides need about twice that in copies around them
+            const auto spacing = std::sqrt(w * h / static_cast<dvoronoi::data::scalar_t>(n));
+            auto margin = 2.5 * spacing * std::sqrt(std::max(1.0, std::log(static_cast<double>(n))) / std::numbers::pi);
+            for (;; margin *= 2) {
+                margin = std::min(margin, std::max(w, h));
+                const auto region = box_t{ domain.left - margin, domain.bottom - margin, domain.right + margin, domain.top + margin };
+
+                extended.assign(wrapped.begin(), wrapped.end());
+                copies.clear();
+                for (std::size_t i = 0; i < n; ++i) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        for (int dy = -1; dy <= 1; ++dy) {
+                            if (dx == 0 && dy == 0)
+                                continue;
+
+                            auto p = dvoronoi::data::point_t{ wrapped[i].x + dx * w, wrapped[i].y + dy * h };
+                            if (p.x >= region.left && p.x <= region.right && p.y >= region.bottom && p.y <= region.top) {
+                                extended.push_back(p);
+                                copies.push_back({ i, dx, dy });
+                            }
+                        }
+                    }
+                }
+
+                diagram.reset();
+                diagram = generate_bounded(extended, region);
+
+                for (std::size_t i = 0; i < n; ++i)
+                    resolved[i] = diagram->faces[i].half_edge != nullptr;
+                for (const auto& he : diagram->half_edges) {
+                    auto i = static_cast<std::size_t>(he.face - diagram->faces.data());
+                    if (i < n && resolved[i] && !is_resolved(he, region))
+                        resolved[i] = false;
+                }
+
+                if (std::ranges::all_of(resolved, [](bool r) { return r; }) || margin >= std::max(w, h))
+                    break;
+            }
+
+            return extract_periodic_cells<diagram_h>(*diagram, resolved, copies, domain, resource);
+        }
+
+    } // namespace _details
+
+} // namespace dvoronoi::fortune
+
+#endif //DVORONOI_PERIODIC_HPP
@@ -0,0 +1,99 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_STATS_HPP
+#define DVORONOI_STATS_HPP
+
+#include <array>
+#include <chrono>
+#include <algorithm>
+
+namespace dvoronoi::fortune {
+
+    enum class phase_t : std::size_t {
+        queue_build, // copying and sorting the sites
+        sweep,
+        bound,
+        clip,
+        layout, // the face major half edge layout
+        merge, // merging duplicate sites
+        delaunay,
+        count
+    };
+
+    // what a generate call went through, filled when passed to generate. Counters and times add up over the calls
+    // made with the same object, peaks are the largest seen; the rotations need an instrumented_workspace_t.
+    struct run_stats_t {
+        static constexpr bool enabled = true;
+
+        typedef std::chrono::steady_clock clock_t;
+
+        std::size_t site_events{0};
+        std::size_t circle_events{0};             // created
+        std::size_t invalidated_circle_events{0}; // removed from the queue before being reached
+        std::size_t peak_event_queue{0};
+        std::size_t peak_beach_line{0};           // arcs
+        std::size_t rotations{0};                 // red-black rotations of the beach line
+        std::size_t vertices{0};
+        std::size_t half_edges{0};
+        std::array<clock_t::duration, static_cast<std::size_t>(phase_t::count)> times{};
+
+        [[nodiscard]] double milliseconds(phase_t phase) const {
+            return std::chrono::duration<double, std::milli>(times[static_cast<std::size_t>(phase)]).count();
+        }
+
+        void reset() { *this = run_stats_t{}; }
+
+        // the hooks generate calls; a site event splits an arc in three, a top site event adds the arc of a site with
+        // nothing above it, and a circle event removes one
+        void begin_sweep() { _arcs = 0; }
+        void site_event(const auto* /*middle arc*/) { add_site_event(2); }
+        void top_site_event(const auto* /*arc*/) { add_site_event(1); }
+        void circle_event_created(std::size_t queue_size) {
+            ++circle_events;
+            peak_event_queue = std::max(peak_event_queue, queue_size);
+        }
+        void circle_event_invalidated() { ++invalidated_circle_events; }
+        void circle_event_handled(const auto* /*arc*/) { --_arcs; }
+        void rotated(std::size_t count) { rotations += count; }
+        void produced(std::size_t vertices_count, std::size_t half_edges_count) {
+            vertices += vertices_count;
+            half_edges += half_edges_count;
+        }
+
+        static clock_t::time_point start() { return clock_t::now(); }
+        void stop(phase_t phase, clock_t::time_point started) { times[static_cast<std::size_t>(phase)] += clock_t::now() - started; }
+
+    private:
+        void add_site_event(std::size_t new_arcs) {
+            ++site_events;
+            _arcs += new_arcs;
+            peak_beach_line = std::max(peak_beach_line, _arcs);
+        }
+
+        std::size_t _arcs{0};
+    };
+
+    // the default, every hook is empty so generate is compiled without any instrumentation
+    struct no_stats_t {
+        static constexpr bool enabled = false;
+
+        struct time_point_t {};
+
+        void begin_sweep() {}
+        void site_event(const auto*) {}
+        void top_site_event(const auto*) {}
+        void circle_event_created(std::size_t) {}
+        void circle_event_invalidated() {}
+        void circle_event_handled(const auto*) {}
+        void rotated(std::size_t) {}
+        void produced(std::size_t, std::size_t) {}
+
+        static time_point_t start() { return {}; }
+        void stop(phase_t, time_point_t) {}
+    };
+
+} // namespace dvoronoi::fortune
+
+#endif //DVORONOI_STATS_HPP
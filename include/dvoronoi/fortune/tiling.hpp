@@ -0,0 +1,315 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_TILING_HPP
+#define DVORONOI_TILING_HPP
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#include "dvoronoi/common/parallel.hpp"
+#include "dvoronoi/common/pair_hash.hpp"
+
+#include "algorithm.hpp"
+
+namespace dvoronoi::fortune {
+
+    struct tiling_config_t {
+        box_t domain{};
+        std::size_t tiles_x{4};
+        std::size_t tiles_y{4};
+        data::scalar_t margin{0}; // guard band around each tile, 0 means estimated from the site density
+        std::size_t threads{0};   // 0 means hardware concurrency
+    };
+
+    struct tile_t {
+        box_t core{};                           // sites inside the core are owned by this tile
+        box_t gather{};                         // core plus guard band, every site inside was fed to the tile diagram
+        std::vector<std::size_t> site_indices{}; // local site index -> input site index
+        std::vector<std::size_t> resolved{};     // local indices of the owned cells, identical to the global ones
+        algorithm::voronoi_diagram_h diagram{};
+    };
+
+    class tiling {
+    public:
+        typedef voronoi_diagram_t diagram_t;
+        typedef data::scalar_t scalar_t;
+
+        // every tile is generated and clipped independently; the guard band is doubled for a tile
+        // until all its owned cells are resolved, so the union of the resolved cells is the global diagram
+        static auto generate_tiles(const auto& sites, const tiling_config_t& config) -> std::vector<tile_t> {
+            assert(!sites.empty());
+            assert(config.tiles_x > 0 && config.tiles_y > 0);
+
+            const auto& domain = config.domain;
+            const auto tile_w = (domain.right - domain.left) / static_cast<scalar_t>(config.tiles_x);
+            const auto tile_h = (domain.top - domain.bottom) / static_cast<scalar_t>(config.tiles_y);
+
+            auto margin = config.margin;
+            if (margin <= 0) {
+                auto spacing = std::sqrt((domain.right - domain.left) * (domain.top - domain.bottom) / static_cast<scalar_t>(sites.size()));
+                margin = 3 * spacing;
+            }
+
+            const auto tile_count = config.tiles_x * config.tiles_y;
+            auto tile_of = [&](scalar_t x, scalar_t y) {
+                auto tx = static_cast<std::size_t>(std::clamp<scalar_t>(std::floor((x - domain.left) / tile_w), 0, static_cast<scalar_t>(config.tiles_x - 1)));
+                auto ty = static_cast<std::size_t>(std::clamp<scalar_t>(std::floor((y - domain.bottom) / tile_h), 0, static_cast<scalar_t>(config.tiles_y - 1)));
+                return ty * config.tiles_x + tx;
+            };
+
+            // bucket sites by owning tile, so gathering only looks at the neighbouring buckets
+            std::vector<std::vector<std::size_t>> owned(tile_count);
+            for (std::size_t i = 0; i < sites.size(); ++i)
+                owned[tile_of(sites[i].x, sites[i].y)].push_back(i);
+
+            std::vector<tile_t> tiles(tile_count);
+
+            parallel::parallel_for(tile_count, [&](std::size_t t) {
+                auto& tile = tiles[t];
+                auto tx = t % config.tiles_x;
+                auto ty = t / config.tiles_x;
+
+                tile.core = box_t{
+                    domain.left + static_cast<scalar_t>(tx) * tile_w, domain.bottom + static_cast<scalar_t>(ty) * tile_h,
+                    domain.left + static_cast<scalar_t>(tx + 1) * tile_w, domain.bottom + static_cast<scalar_t>(ty + 1) * tile_h
+                };
+
+                if (owned[t].empty())
+                    return;
+
+                for (auto tile_margin = margin; ; tile_margin *= 2) {
+                    generate_tile(sites, owned, t, config, tile_w, tile_h, tile_margin, tile);
+
+                    if (tile.resolved.size() == owned[t].size() || covers(tile.gather, domain))
+                        break;
+                }
+            }, config.threads);
+
+            return tiles;
+        }
+
+        // stitches the resolved cells of all tiles into one diagram, indexed like the input sites
+        static auto generate(const auto& sites, const tiling_config_t& config) -> algorithm::voronoi_diagram_h {
+            auto tiles = generate_tiles(sites, config);
+
+            std::size_t half_edges_count = 0;
+            for (const auto& tile : tiles) {
+                for (auto local : tile.resolved)
+                    half_edges_count += ring_size(tile.diagram->faces[local]);
+            }
+
+            auto diagram = std::make_unique<diagram_t>(sites.size());
+            diagram->half_edges.reserve(half_edges_count);
+            diagram->vertices.reserve(half_edges_count);
+
+            for (std::size_t i = 0; i < sites.size(); ++i) {
+                diagram->sites.emplace_back(i, sites[i].x, sites[i].y);
+                diagram->faces.emplace_back(&diagram->sites.back());
+                diagram->sites.back().face = &diagram->faces.back();
+            }
+
+            std::unordered_map<std::pair<std::size_t, std::size_t>, data::half_edge_t*, pair_hash> created_half_edges;
+            created_half_edges.reserve(half_edges_count);
+
+            // orig pointers still refer to the tile vertices at this point, they are replaced below
+            for (const auto& tile : tiles) {
+                for (auto local : tile.resolved) {
+                    const auto& local_face = tile.diagram->faces[local];
+                    auto global = tile.site_indices[local];
+                    auto face = &diagram->faces[global];
+
+                    data::half_edge_t* first = nullptr;
+                    data::half_edge_t* prev = nullptr;
+
+                    auto he = local_face.half_edge;
+                    do {
+                        auto new_he = diagram->create_half_edge(face);
+                        new_he->orig = he->orig;
+
+                        if (he->twin) {
+                            auto neighbor = tile.site_indices[he->twin->face->site->index];
+                            created_half_edges.emplace(std::make_pair(global, neighbor), new_he);
+
+                            auto twin_iter = created_half_edges.find(std::make_pair(neighbor, global));
+                            if (twin_iter != created_half_edges.end()) {
+                                new_he->twin = twin_iter->second;
+                                twin_iter->second->twin = new_he;
+                            }
+                        }
+
+                        if (prev)
+                            _details::set_prev_half_edge(prev, new_he);
+                        else
+                            first = new_he;
+                        prev = new_he;
+
+                        he = he->next;
+                    } while (he != local_face.half_edge);
+
+                    _details::set_prev_half_edge(prev, first);
+                }
+            }
+
+            // a vertex is shared by all the half edges obtained by rotating around it through twins
+            std::vector<bool> assigned(diagram->half_edges.size(), false);
+            for (auto& start : diagram->half_edges) {
+                if (assigned[start.index])
+                    continue;
+
+                auto vertex = diagram->create_vertex(start.orig->point);
+
+                auto he = &start;
+                do {
+                    he->orig = vertex;
+                    assigned[he->index] = true;
+                    he = he->prev->twin;
+                } while (he != nullptr && he != &start);
+
+                he = start.twin ? start.twin->next : nullptr;
+                while (he != nullptr && !assigned[he->index]) {
+                    he->orig = vertex;
+                    assigned[he->index] = true;
+                    he = he->twin ? he->twin->next : nullptr;
+                }
+            }
+
+            for (auto& he : diagram->half_edges)
+                he.dest = he.next->orig;
+
+            return diagram;
+        }
+
+        // true if every site has the same cell in both diagrams, regardless of the ring's starting half edge
+        static bool same_cells(const diagram_t& lhs, const diagram_t& rhs, scalar_t tolerance = 1e-6) {
+            if (lhs.faces.size() != rhs.faces.size())
+                return false;
+
+            auto contained = [tolerance](const auto& points, const auto& others) {
+                return std::ranges::all_of(points, [&others, tolerance](const data::point_t& p) {
+                    return std::ranges::any_of(others, [&p, tolerance](const data::point_t& o) {
+                        return std::fabs(p.x - o.x) <= tolerance && std::fabs(p.y - o.y) <= tolerance;
+                    });
+                });
+            };
+
+            for (std::size_t i = 0; i < lhs.faces.size(); ++i) {
+                if (!lhs.faces[i].half_edge || !rhs.faces[i].half_edge) {
+                    if (lhs.faces[i].half_edge != rhs.faces[i].half_edge)
+                        return false;
+                    continue;
+                }
+
+                auto lhs_points = data::get_face_vertices(lhs.faces[i]);
+                auto rhs_points = data::get_face_vertices(rhs.faces[i]);
+
+                if (!contained(lhs_points, rhs_points) || !contained(rhs_points, lhs_points))
+                    return false;
+            }
+
+            return true;
+        }
+
+    private:
+        static void generate_tile(const auto& sites, const std::vector<std::vector<std::size_t>>& owned, std::size_t own_index,
+                                  const tiling_config_t& config, scalar_t tile_w, scalar_t tile_h, scalar_t margin, tile_t& tile) {
+            const auto& domain = config.domain;
+            tile.gather = box_t{ tile.core.left - margin, tile.core.bottom - margin, tile.core.right + margin, tile.core.top + margin };
+
+            auto first_tx = static_cast<std::size_t>(std::max<scalar_t>(0, std::floor((tile.gather.left - domain.left) / tile_w)));
+            auto last_tx = static_cast<std::size_t>(std::clamp<scalar_t>(std::floor((tile.gather.right - domain.left) / tile_w), 0, static_cast<scalar_t>(config.tiles_x - 1)));
+            auto first_ty = static_cast<std::size_t>(std::max<scalar_t>(0, std::floor((tile.gather.bottom - domain.bottom) / tile_h)));
+            auto last_ty = static_cast<std::size_t>(std::clamp<scalar_t>(std::floor((tile.gather.top - domain.bottom) / tile_h), 0, static_cast<scalar_t>(config.tiles_y - 1)));
+
+            tile.site_indices.clear();
+            std::vector<data::point_t> local_sites;
+
+            auto gather_bucket = [&](const std::vector<std::size_t>& bucket, bool is_owned) {
+                for (auto i : bucket) {
+                    const auto& s = sites[i];
+                    if (!is_owned && !(s.x >= tile.gather.left && s.x <= tile.gather.right && s.y >= tile.gather.bottom && s.y <= tile.gather.top))
+                        continue;
+
+                    tile.site_indices.push_back(i);
+                    local_sites.push_back({ static_cast<scalar_t>(s.x), static_cast<scalar_t>(s.y) });
+                }
+            };
+
+            // owned sites go first, so the owned cells are the local indices [0, owned count)
+            gather_bucket(owned[own_index], true);
+            const auto owned_count = local_sites.size();
+
+            for (auto ty = first_ty; ty <= last_ty; ++ty) {
+                for (auto tx = first_tx; tx <= last_tx; ++tx) {
+                    if (ty * config.tiles_x + tx != own_index)
+                        gather_bucket(owned[ty * config.tiles_x + tx], false);
+                }
+            }
+
+            auto bounding_box = box_t{
+                std::max(tile.gather.left, domain.left), std::max(tile.gather.bottom, domain.bottom),
+                std::min(tile.gather.right, domain.right), std::min(tile.gather.top, domain.top)
+            };
+
+            tile.diagram = algorithm::generate(local_sites, config_t{ bounding_box, true });
+
+            tile.resolved.clear();
+            for (std::size_t local = 0; local < owned_count; ++local) {
+                if (is_resolved(tile.diagram->faces[local], tile.gather, domain))
+                    tile.resolved.push_back(local);
+            }
+        }
+
+        // a cell can only be cut by a missing site if one of its vertices' empty circles leaves the gathered region,
+        // gather sides lying outside the domain can't hide any site, so they are ignored
+        static bool is_resolved(const data::face_t& face, const box_t& gather, const box_t& domain) {
+            if (!face.half_edge)
+                return false;
+
+            const auto& site = face.site->point;
+
+            auto he = face.half_edge;
+            do {
+                const auto& v = he->orig->point;
+                auto r = v.dist(site) * (1 + 1e-9);
+
+                if (gather.left > domain.left && v.x - r < gather.left)
+                    return false;
+                if (gather.right < domain.right && v.x + r > gather.right)
+                    return false;
+                if (gather.bottom > domain.bottom && v.y - r < gather.bottom)
+                    return false;
+                if (gather.top < domain.top && v.y + r > gather.top)
+                    return false;
+
+                he = he->next;
+            } while (he != face.half_edge);
+
+            return true;
+        }
+
+        static bool covers(const box_t& gather, const box_t& domain) {
+            return gather.left <= domain.left && gather.bottom <= domain.bottom && gather.right >= domain.right && gather.top >= domain.top;
+        }
+
+        static std::size_t ring_size(const data::face_t& face) {
+            if (!face.half_edge)
+                return 0;
+
+            std::size_t size = 0;
+            auto he = face.half_edge;
+            do {
+                ++size;
+                he = he->next;
+            } while (he != face.half_edge);
+
+            return size;
+        }
+    };
+
+} // namespace dvoronoi::fortune
+
+#endif //DVORONOI_TILING_HPP
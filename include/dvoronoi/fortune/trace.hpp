@@ -0,0 +1,113 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_TRACE_HPP
+#define DVORONOI_TRACE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+#include "dvoronoi/common/data.hpp"
+
+#include "stats.hpp"
+
+namespace dvoronoi::fortune {
+
+    // the beach line operations of the sweeps of the generate calls it is passed to as stats, so they can be replayed
+    // against any beach line backend without the event queue and the diagram. Arcs get ids in creation order, which a
+    // replay follows, so a circle event names the arc it removes by id
+    class beach_line_trace_t : public no_stats_t {
+    public:
+        enum class kind_t : std::uint8_t {
+            root,     // starts a sweep
+            top_site, // a site level with the first one, added leftmost
+            site,     // the site's arc splits the one above it, creating three
+            circle    // removes an arc
+        };
+
+        struct event_t {
+            kind_t kind;
+            std::size_t id; // into points, or of the removed arc
+        };
+
+        std::vector<event_t> events{};
+        std::vector<dvoronoi::data::point_t> points{}; // of the sites, in event order
+
+        [[nodiscard]] std::size_t arcs_count() const { return _next_id; }
+
+        void begin_sweep() {
+            _ids.clear();
+            _root = true;
+        }
+
+        void site_event(const auto* middle_arc) {
+            add_site(kind_t::site, middle_arc->site->point);
+            _ids[middle_arc->prev] = _next_id++;
+            _ids[middle_arc] = _next_id++;
+            _ids[middle_arc->next] = _next_id++;
+        }
+
+        void top_site_event(const auto* arc) {
+            add_site(_root ? kind_t::root : kind_t::top_site, arc->site->point);
+            _root = false;
+            _ids[arc] = _next_id++;
+        }
+
+        void circle_event_handled(const auto* arc) { events.push_back({ kind_t::circle, _ids[arc] }); }
+
+    private:
+        void add_site(kind_t kind, const dvoronoi::data::point_t& point) {
+            events.push_back({ kind, points.size() });
+            points.push_back(point);
+        }
+
+        std::unordered_map<const void*, std::size_t> _ids{};
+        std::size_t _next_id{0};
+        bool _root{true};
+    };
+
+    // runs the trace's operations on beach_line, which is left with the last sweep's arcs; the site copies and the
+    // arc table cost the same for every backend
+    template<typename beach_line_t>
+    void replay(const beach_line_trace_t& trace, beach_line_t& beach_line) {
+        typedef beach_line_trace_t::kind_t kind_t;
+
+        std::vector<dvoronoi::data::site_t> sites;
+        sites.reserve(trace.points.size());
+        for (std::size_t i = 0; i < trace.points.size(); ++i)
+            sites.emplace_back(i, trace.points[i].x, trace.points[i].y);
+
+        std::vector<typename beach_line_t::arc_t*> arcs(trace.arcs_count());
+        std::size_t next_id = 0;
+
+        for (const auto& event : trace.events) {
+            switch (event.kind) {
+                case kind_t::root:
+                    beach_line.clear();
+                    beach_line.set_root(&sites[event.id]);
+                    arcs[next_id++] = beach_line.leftmost_arc();
+                    break;
+                case kind_t::top_site:
+                    arcs[next_id++] = beach_line.add_leftmost(&sites[event.id]);
+                    break;
+                case kind_t::site: {
+                    auto& site = sites[event.id];
+                    auto middle_arc = beach_line.break_arc(beach_line.arc_above(site.point, site.point.y), &site);
+                    arcs[next_id++] = middle_arc->prev;
+                    arcs[next_id++] = middle_arc;
+                    arcs[next_id++] = middle_arc->next;
+                    break;
+                }
+                case kind_t::circle:
+                    beach_line.remove(arcs[event.id]);
+                    beach_line.delete_arc(arcs[event.id]);
+                    break;
+            }
+        }
+    }
+
+} // namespace dvoronoi::fortune
+
+#endif //DVORONOI_TRACE_HPP
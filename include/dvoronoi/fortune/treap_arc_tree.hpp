@@ -0,0 +1,119 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_TREAP_ARC_TREE_HPP
+#define DVORONOI_TREAP_ARC_TREE_HPP
+
+#include <cstdint>
+
+#include "arc_tree.hpp"
+
+namespace dvoronoi::fortune::_details {
+
+    // a beach line backend keeping the arcs in a treap instead of a red-black tree: the same storage, links and
+    // rotations, but the balance comes from a priority hashed from each arc's address, so there is no color
+    // bookkeeping and an insertion or removal only rotates along one path. Arcs are keyed implicitly by their order
+    template<typename arc_t, bool counted = false>
+    class treap_arc_tree_t : protected arc_tree_t<arc_t, counted> {
+        typedef arc_tree_t<arc_t, counted> base_t;
+
+    protected:
+        explicit treap_arc_tree_t(std::pmr::memory_resource* resource) : base_t(resource) {}
+
+        // splitmix64's finalizer, recycled arcs keep their priority wherever they are reinserted
+        static std::uint64_t priority(const arc_t* arc) {
+            auto z = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(arc));
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        void replace(arc_t* arc, arc_t* other) {
+            base_t::replace(arc, other);
+            sift_up(other);
+            sift_down(other);
+        }
+
+        void remove(arc_t* arc) {
+            // rotated down below its higher priority child until it has at most one
+            while (!this->is_nil(arc->left) && !this->is_nil(arc->right)) {
+                if (priority(arc->left) > priority(arc->right))
+                    this->right_rotate(arc);
+                else
+                    this->left_rotate(arc);
+            }
+
+            this->transplant(arc, this->is_nil(arc->left) ? arc->right : arc->left);
+
+            if (!this->is_nil(arc->prev))
+                arc->prev->next = arc->next;
+            if (!this->is_nil(arc->next))
+                arc->next->prev = arc->prev;
+        }
+
+        void insert_before(arc_t* before, arc_t* arc) {
+            if (this->is_nil(before->left)) {
+                before->left = arc;
+                arc->parent = before;
+            } else {
+                before->prev->right = arc;
+                arc->parent = before->prev;
+            }
+
+            arc->prev = before->prev;
+            if (!this->is_nil(arc->prev))
+                arc->prev->next = arc;
+            arc->next = before;
+            before->prev = arc;
+
+            sift_up(arc);
+        }
+
+        void insert_after(arc_t* after, arc_t* arc) {
+            if (this->is_nil(after->right)) {
+                after->right = arc;
+                arc->parent = after;
+            } else {
+                after->next->left = arc;
+                arc->parent = after->next;
+            }
+
+            arc->next = after->next;
+            if (!this->is_nil(arc->next))
+                arc->next->prev = arc;
+            arc->prev = after;
+            after->next = arc;
+
+            sift_up(arc);
+        }
+
+    private:
+        void sift_up(arc_t* arc) {
+            while (!this->is_nil(arc->parent) && priority(arc) > priority(arc->parent)) {
+                if (arc == arc->parent->left)
+                    this->right_rotate(arc->parent);
+                else
+                    this->left_rotate(arc->parent);
+            }
+        }
+
+        void sift_down(arc_t* arc) {
+            for (;;) {
+                auto child = arc->left;
+                if (this->is_nil(child) || (!this->is_nil(arc->right) && priority(arc->right) > priority(child)))
+                    child = arc->right;
+                if (this->is_nil(child) || priority(child) <= priority(arc))
+                    return;
+
+                if (child == arc->left)
+                    this->right_rotate(arc);
+                else
+                    this->left_rotate(arc);
+            }
+        }
+    };
+
+} // namespace dvoronoi::fortune::_details
+
+#endif //DVORONOI_TREAP_ARC_TREE_HPP
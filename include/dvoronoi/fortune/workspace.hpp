@@ -0,0 +1,59 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_WORKSPACE_HPP
+#define DVORONOI_WORKSPACE_HPP
+
+#include <vector>
+#include <memory_resource>
+
+#include "dvoronoi/common/diagram.hpp"
+#include "dvoronoi/common/priority_queue.hpp"
+
+#include "event.hpp"
+#include "beach_line.hpp"
+
+namespace dvoronoi::fortune {
+
+    // where each structure of a generate call allocates from, the default resource unless given
+    struct memory_resources_t {
+        std::pmr::memory_resource* event_queue = std::pmr::get_default_resource();
+        std::pmr::memory_resource* beach_line = std::pmr::get_default_resource();
+        std::pmr::memory_resource* site_order = std::pmr::get_default_resource();
+        std::pmr::memory_resource* diagram = std::pmr::get_default_resource(); // of the returned diagrams
+    };
+
+    // the sweep's scratch structures; reusing one across generate calls keeps their memory,
+    // so only the returned diagram is allocated. Not thread safe, use one per thread.
+    // An instrumented workspace also counts the beach line's rotations for run_stats_t; ordered_t picks the beach
+    // line backend.
+    template<bool instrumented = false, template<typename, bool> typename ordered_t = _details::arc_tree_t>
+    struct basic_workspace_t {
+        priority_queue_t<_details::event_t<diag_traits>> event_queue;
+        _details::beach_line_t<diag_traits, instrumented, ordered_t> beach_line;
+        std::pmr::vector<std::size_t> site_order;
+        std::pmr::memory_resource* diagram_resource;
+        // pairs of half edges between the topmost sites, open upwards until bound
+        std::size_t top_edges{0};
+
+        explicit basic_workspace_t(const memory_resources_t& resources = memory_resources_t{})
+            : event_queue(resources.event_queue), beach_line(resources.beach_line), site_order(resources.site_order)
+            , diagram_resource(resources.diagram) {}
+
+        void reset(std::size_t sites_count) {
+            top_edges = 0;
+            event_queue.clear();
+            event_queue.reserve(sites_count);
+            beach_line.clear();
+            site_order.clear();
+        }
+    };
+
+    typedef basic_workspace_t<false> workspace_t;
+    typedef basic_workspace_t<true> instrumented_workspace_t;
+    typedef basic_workspace_t<false, _details::treap_arc_tree_t> treap_workspace_t;
+
+} // namespace dvoronoi::fortune
+
+#endif //DVORONOI_WORKSPACE_HPP
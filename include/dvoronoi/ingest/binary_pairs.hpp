@@ -0,0 +1,56 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_INGEST_BINARY_PAIRS_HPP
+#define DVORONOI_INGEST_BINARY_PAIRS_HPP
+
+#include <bit>
+#include <span>
+#include <optional>
+#include <filesystem>
+
+#include "dvoronoi/common/mapped_file.hpp"
+
+#include "extents.hpp"
+
+namespace dvoronoi::ingest {
+
+    struct pair_t {
+        double x;
+        double y;
+    };
+
+    // raw little-endian float64 (x, y) pairs, mapped and used in place: sites() can be passed
+    // to algorithm::generate directly, without copying the points
+    class mapped_sites_t {
+    public:
+        // fails for missing or empty files, sizes that aren't a whole number of pairs and big-endian hosts
+        static std::optional<mapped_sites_t> open(const std::filesystem::path& path, std::size_t threads = 0) {
+            if constexpr (std::endian::native != std::endian::little)
+                return std::nullopt;
+
+            auto file = mapped_file_t::open(path);
+            if (!file || file->size() % sizeof(pair_t) != 0)
+                return std::nullopt;
+
+            return mapped_sites_t(std::move(*file), threads);
+        }
+
+        [[nodiscard]] std::span<const pair_t> sites() const {
+            return { reinterpret_cast<const pair_t*>(_file.data()), _file.size() / sizeof(pair_t) };
+        }
+
+        [[nodiscard]] const box_t& extents() const { return _extents; }
+
+    private:
+        mapped_sites_t(mapped_file_t&& file, std::size_t threads) : _file(std::move(file)), _extents(compute_extents(sites(), threads)) {}
+
+    private:
+        mapped_file_t _file;
+        box_t _extents;
+    };
+
+} // namespace dvoronoi::ingest
+
+#endif //DVORONOI_INGEST_BINARY_PAIRS_HPP
@@ -0,0 +1,148 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_INGEST_CSV_HPP
+#define DVORONOI_INGEST_CSV_HPP
+
+#include <vector>
+#include <charconv>
+#include <optional>
+#include <string_view>
+#include <filesystem>
+
+#include "dvoronoi/common/point.hpp"
+#include "dvoronoi/common/mapped_file.hpp"
+#include "dvoronoi/common/parallel.hpp"
+
+#include "extents.hpp"
+
+namespace dvoronoi::ingest {
+
+    struct csv_config_t {
+        char delimiter{','};
+        std::size_t x_column{0};
+        std::size_t y_column{1};
+        bool header{false};       // skip the first line
+        std::size_t threads{0};   // 0 means hardware concurrency
+    };
+
+    struct csv_sites_t {
+        std::vector<_internal::point2_t> sites{};
+        box_t extents{ empty_extents() };
+        std::size_t skipped_lines{0}; // non empty lines without two parsable coordinates
+    };
+
+    namespace _details {
+
+        inline bool parse_field(std::string_view field, _internal::scalar_t& value) {
+            while (!field.empty() && (field.front() == ' ' || field.front() == '\t' || field.front() == '+'))
+                field.remove_prefix(1);
+            while (!field.empty() && (field.back() == ' ' || field.back() == '\t' || field.back() == '\r'))
+                field.remove_suffix(1);
+
+            auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+            return error == std::errc{} && end == field.data() + field.size();
+        }
+
+        inline bool parse_line(std::string_view line, const csv_config_t& config, _internal::point2_t& point) {
+            const auto last_column = std::max(config.x_column, config.y_column);
+            bool has_x = false, has_y = false;
+
+            for (std::size_t column = 0; column <= last_column; ++column) {
+                auto delimiter = line.find(config.delimiter);
+                auto field = line.substr(0, delimiter);
+
+                if (column == config.x_column)
+                    has_x = parse_field(field, point.x);
+                if (column == config.y_column)
+                    has_y = parse_field(field, point.y);
+
+                if (delimiter == std::string_view::npos)
+                    break;
+                line.remove_prefix(delimiter + 1);
+            }
+
+            return has_x && has_y;
+        }
+
+        struct csv_chunk_t {
+            std::vector<_internal::point2_t> sites{};
+            box_t extents{ empty_extents() };
+            std::size_t skipped_lines{0};
+        };
+
+        inline void parse_chunk(std::string_view text, const csv_config_t& config, csv_chunk_t& chunk) {
+            chunk.sites.reserve(text.size() / 16);
+
+            while (!text.empty()) {
+                auto eol = text.find('\n');
+                auto line = text.substr(0, eol);
+                text.remove_prefix(eol == std::string_view::npos ? text.size() : eol + 1);
+
+                if (line.empty() || line == "\r")
+                    continue;
+
+                _internal::point2_t point;
+                if (!parse_line(line, config, point)) {
+                    ++chunk.skipped_lines;
+                    continue;
+                }
+
+                chunk.sites.push_back(point);
+                expand(chunk.extents, point.x, point.y);
+            }
+        }
+
+    } // namespace _details
+
+    // the mapped file is split into chunks at line boundaries, parsed in parallel and concatenated in file order
+    inline std::optional<csv_sites_t> load_csv(const std::filesystem::path& path, const csv_config_t& config = csv_config_t{}) {
+        auto file = mapped_file_t::open(path);
+        if (!file)
+            return std::nullopt;
+
+        auto text = std::string_view(reinterpret_cast<const char*>(file->data()), file->size());
+
+        if (config.header) {
+            auto eol = text.find('\n');
+            text.remove_prefix(eol == std::string_view::npos ? text.size() : eol + 1);
+        }
+
+        const auto threads = parallel::thread_count(config.threads);
+        const auto chunks_count = std::clamp<std::size_t>(text.size() / (1 << 20), 1, 4 * threads);
+
+        // chunk c starts right after the first line break at or after c * size / chunks_count
+        std::vector<std::size_t> starts(chunks_count + 1, text.size());
+        starts[0] = 0;
+        for (std::size_t c = 1; c < chunks_count; ++c) {
+            auto eol = text.find('\n', std::max(c * text.size() / chunks_count, starts[c - 1]));
+            starts[c] = eol == std::string_view::npos ? text.size() : eol + 1;
+        }
+
+        std::vector<_details::csv_chunk_t> chunks(chunks_count);
+        parallel::parallel_for(chunks_count, [&text, &starts, &config, &chunks](std::size_t c) {
+            _details::parse_chunk(text.substr(starts[c], starts[c + 1] - starts[c]), config, chunks[c]);
+        }, threads);
+
+        csv_sites_t result;
+
+        std::vector<std::size_t> offsets(chunks_count + 1, 0);
+        for (std::size_t c = 0; c < chunks_count; ++c) {
+            offsets[c + 1] = offsets[c] + chunks[c].sites.size();
+            expand(result.extents, chunks[c].extents);
+            result.skipped_lines += chunks[c].skipped_lines;
+        }
+
+        result.sites.resize(offsets.back());
+        parallel::parallel_for(chunks_count, [&result, &offsets, &chunks](std::size_t c) {
+            std::ranges::copy(chunks[c].sites, result.sites.begin() + static_cast<std::ptrdiff_t>(offsets[c]));
+            chunks[c].sites = {};
+        }, threads);
+
+        return result;
+    }
+
+} // namespace dvoronoi::ingest
+
+#endif //DVORONOI_INGEST_CSV_HPP
@@ -0,0 +1,55 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_INGEST_EXTENTS_HPP
+#define DVORONOI_INGEST_EXTENTS_HPP
+
+#include <limits>
+#include <mutex>
+
+#include "dvoronoi/common/box.hpp"
+#include "dvoronoi/common/parallel.hpp"
+
+namespace dvoronoi::ingest {
+
+    // inverted box, so that expanding it by the first point gives that point
+    inline box_t empty_extents() {
+        constexpr auto inf = std::numeric_limits<_internal::scalar_t>::infinity();
+        return box_t{ inf, inf, -inf, -inf };
+    }
+
+    inline void expand(box_t& extents, _internal::scalar_t x, _internal::scalar_t y) {
+        extents.left = std::min(extents.left, x);
+        extents.bottom = std::min(extents.bottom, y);
+        extents.right = std::max(extents.right, x);
+        extents.top = std::max(extents.top, y);
+    }
+
+    inline void expand(box_t& extents, const box_t& other) {
+        extents.left = std::min(extents.left, other.left);
+        extents.bottom = std::min(extents.bottom, other.bottom);
+        extents.right = std::max(extents.right, other.right);
+        extents.top = std::max(extents.top, other.top);
+    }
+
+    // min/max of any random access container of points with .x/.y, usable as config_t::bounding_box
+    box_t compute_extents(const auto& sites, std::size_t threads = 0) {
+        auto extents = empty_extents();
+        std::mutex mutex;
+
+        parallel::parallel_for_chunks(sites.size(), [&sites, &extents, &mutex](std::size_t begin, std::size_t end) {
+            auto chunk_extents = empty_extents();
+            for (auto i = begin; i < end; ++i)
+                expand(chunk_extents, sites[i].x, sites[i].y);
+
+            std::scoped_lock lock(mutex);
+            expand(extents, chunk_extents);
+        }, threads, 1 << 16);
+
+        return extents;
+    }
+
+} // namespace dvoronoi::ingest
+
+#endif //DVORONOI_INGEST_EXTENTS_HPP
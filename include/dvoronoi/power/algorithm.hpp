@@ -0,0 +1,83 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_POWER_ALGORITHM_HPP
+#define DVORONOI_POWER_ALGORITHM_HPP
+
+#include <memory>
+#include <vector>
+#include <cassert>
+
+#include "dvoronoi/common/diagram.hpp"
+#include "dvoronoi/common/clipping.hpp"
+#include "dvoronoi/common/dual.hpp"
+#include "dvoronoi/common/reorder.hpp"
+#include "dvoronoi/fortune/config.hpp"
+
+#include "triangulation.hpp"
+
+namespace dvoronoi::power {
+
+    // power (Laguerre) diagrams: the cell of site i holds the points p minimising |p - s_i|^2 - w_i.
+    // Built from the dual regular triangulation rather than the sweep: unlike in the unweighted case, a weighted site
+    // joins the beach line at a time that depends on its neighbours, so site events cannot be ordered upfront.
+    // Sites whose cell is empty get a face with a null half_edge.
+    class algorithm {
+    public:
+        typedef voronoi_diagram_t diagram_t;
+        using voronoi_diagram_h = std::unique_ptr<diagram_t>;
+        typedef fortune::config_t config_t;
+
+        // cells are always bounded: by config's bounding box, or the sites' extents when it is missing, enlarged to
+        // contain every power vertex like bound() does, or clipped to the bounding box itself when config.clip is set.
+        // Sites are never merged, coincident ones with different weights not being duplicates
+        static auto generate(const auto& sites, const auto& weights, const config_t& config = config_t{}) {
+            assert(!sites.empty());
+            assert(weights.size() == sites.size());
+            assert(!config.merge_tolerance.has_value());
+
+            const auto n = sites.size();
+
+            auto extents = box_t{ sites[0].x, sites[0].y, sites[0].x, sites[0].y };
+            for (std::size_t i = 0; i < n; ++i) {
+                extents.left = std::min<data::scalar_t>(extents.left, sites[i].x);
+                extents.bottom = std::min<data::scalar_t>(extents.bottom, sites[i].y);
+                extents.right = std::max<data::scalar_t>(extents.right, sites[i].x);
+                extents.top = std::max<data::scalar_t>(extents.top, sites[i].y);
+            }
+
+            auto box = config.bounding_box.value_or(extents);
+            auto ghost_box = box_t{ std::min(box.left, extents.left), std::min(box.bottom, extents.bottom),
+                                    std::max(box.right, extents.right), std::max(box.top, extents.top) };
+
+            _details::regular_triangulation_t triangulation;
+            triangulation.init(n, [&sites, &weights](std::size_t i) {
+                return _details::weighted_point_t{ sites[i].x, sites[i].y, static_cast<data::scalar_t>(weights[i]) };
+            }, ghost_box);
+            triangulation.build();
+
+            auto diagram = std::make_unique<diagram_t>(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                diagram->sites.emplace_back(i, sites[i].x, sites[i].y);
+                diagram->faces.emplace_back(&diagram->sites.back());
+                diagram->sites.back().face = &diagram->faces.back();
+            }
+
+            dvoronoi::_details::build_dual_cells(triangulation, *diagram);
+
+            if (config.clip && config.bounding_box.has_value())
+                voronoi::clip(*diagram, convex_polygon_t::from_box(box));
+            else
+                voronoi::clip(*diagram, convex_polygon_t::from_box(dvoronoi::_details::enclose_dual_vertices(triangulation, box)));
+
+            if (config.face_major)
+                compact_rings(*diagram);
+
+            return diagram;
+        }
+    };
+
+} // namespace dvoronoi::power
+
+#endif //DVORONOI_POWER_ALGORITHM_HPP
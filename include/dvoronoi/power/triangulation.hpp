@@ -0,0 +1,284 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_POWER_TRIANGULATION_HPP
+#define DVORONOI_POWER_TRIANGULATION_HPP
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+
+#include "dvoronoi/common/data.hpp"
+#include "dvoronoi/common/box.hpp"
+
+namespace dvoronoi::power::_details {
+
+    typedef data::scalar_t scalar_t;
+
+    constexpr std::uint32_t no_triangle = std::numeric_limits<std::uint32_t>::max();
+
+    struct weighted_point_t {
+        scalar_t x;
+        scalar_t y;
+        scalar_t w;
+    };
+
+    struct triangle_t {
+        std::array<std::uint32_t, 3> v; // counter-clockwise
+        std::array<std::uint32_t, 3> n; // n[i] is the triangle across the edge opposite v[i]
+        bool alive;
+    };
+
+    // regular (weighted Delaunay) triangulation, i.e. the lower convex hull of the points lifted to
+    // (x, y, x^2 + y^2 - w). Built by incremental Bowyer-Watson insertion inside four far away ghost points,
+    // points lifted above the hull are redundant and end up in no triangle.
+    class regular_triangulation_t {
+    public:
+        std::vector<weighted_point_t> points{};
+        std::vector<triangle_t> triangles{};
+        std::size_t ghosts_begin{0};
+
+        // the points to triangulate, followed by the four ghosts: a square around box, with the smallest weight
+        void init(std::size_t count, const auto& point_at, const box_t& box) {
+            points.clear();
+            points.reserve(count + 4);
+
+            auto min_weight = std::numeric_limits<scalar_t>::infinity();
+            for (std::size_t i = 0; i < count; ++i) {
+                points.push_back(point_at(i));
+                min_weight = std::min(min_weight, points.back().w);
+            }
+
+            const auto cx = (box.left + box.right) / 2, cy = (box.bottom + box.top) / 2;
+            const auto r = 16 * std::max({ box.right - box.left, box.top - box.bottom, scalar_t(1) });
+
+            ghosts_begin = count;
+            points.push_back({ cx - r, cy - r, min_weight });
+            points.push_back({ cx + r, cy - r, min_weight });
+            points.push_back({ cx + r, cy + r, min_weight });
+            points.push_back({ cx - r, cy + r, min_weight });
+
+            const auto g = static_cast<std::uint32_t>(count);
+            triangles.clear();
+            triangles.reserve(2 * count + 8);
+            triangles.push_back({ { g, g + 1, g + 2 }, { no_triangle, 1, no_triangle }, true });
+            triangles.push_back({ { g, g + 2, g + 3 }, { no_triangle, no_triangle, 0 }, true });
+
+            _free.clear();
+            _marks.assign(triangles.capacity(), 0);
+            _stamp = 0;
+            _last = 0;
+            _links.assign(points.size(), no_triangle);
+        }
+
+        // inserts the points in strips, snaking up and down, so consecutive points are close and the walks short
+        void build() {
+            const auto count = ghosts_begin;
+
+            std::vector<std::uint32_t> order(count);
+            for (std::uint32_t i = 0; i < count; ++i)
+                order[i] = i;
+
+            if (count > 0) {
+                auto min_x = points[0].x, max_x = points[0].x;
+                for (std::size_t i = 0; i < count; ++i) {
+                    min_x = std::min(min_x, points[i].x);
+                    max_x = std::max(max_x, points[i].x);
+                }
+
+                const auto strips = std::max<std::size_t>(1, static_cast<std::size_t>(std::sqrt(static_cast<double>(count) / 4)));
+                const auto strip_w = (max_x - min_x) / static_cast<scalar_t>(strips);
+                auto strip_of = [this, min_x, strip_w, strips](std::uint32_t i) {
+                    return strip_w > 0 ? std::min(strips - 1, static_cast<std::size_t>((points[i].x - min_x) / strip_w)) : 0;
+                };
+
+                std::ranges::sort(order, [this, &strip_of](std::uint32_t a, std::uint32_t b) {
+                    auto sa = strip_of(a), sb = strip_of(b);
+                    if (sa != sb)
+                        return sa < sb;
+                    return (sa % 2 == 0) ? points[a].y < points[b].y : points[a].y > points[b].y;
+                });
+            }
+
+            for (auto i : order)
+                insert(i);
+        }
+
+        [[nodiscard]] bool is_ghost(std::uint32_t v) const { return v >= ghosts_begin; }
+
+        // the point with equal power distance to the triangle's three points
+        [[nodiscard]] data::point_t power_center(const triangle_t& t) const {
+            const auto& a = points[t.v[0]];
+            const auto& b = points[t.v[1]];
+            const auto& c = points[t.v[2]];
+
+            auto bx = b.x - a.x, by = b.y - a.y;
+            auto cx = c.x - a.x, cy = c.y - a.y;
+            auto bl = bx * bx + by * by - (b.w - a.w);
+            auto cl = cx * cx + cy * cy - (c.w - a.w);
+            auto d = 2 * (bx * cy - by * cx);
+
+            return { a.x + (cy * bl - by * cl) / d, a.y + (bx * cl - cx * bl) / d };
+        }
+
+        static std::size_t index_of(const triangle_t& t, std::uint32_t v) {
+            return t.v[0] == v ? 0 : (t.v[1] == v ? 1 : 2);
+        }
+
+    private:
+        struct boundary_edge_t {
+            std::uint32_t a;
+            std::uint32_t b;
+            std::uint32_t outside;
+        };
+
+        std::vector<std::uint32_t> _free{};
+        std::vector<std::uint32_t> _marks{};
+        std::uint32_t _stamp{0};
+        std::uint32_t _last{0};
+        std::vector<std::uint32_t> _links{};
+        std::vector<std::uint32_t> _cavity{};
+        std::vector<boundary_edge_t> _boundary{};
+
+        [[nodiscard]] scalar_t orient(std::uint32_t a, std::uint32_t b, const weighted_point_t& p) const {
+            const auto& pa = points[a];
+            const auto& pb = points[b];
+            return (pb.x - pa.x) * (p.y - pa.y) - (pb.y - pa.y) * (p.x - pa.x);
+        }
+
+        // positive when p lifted is below the plane through the lifted triangle, i.e. p conflicts with it
+        [[nodiscard]] bool conflicts(const triangle_t& t, const weighted_point_t& p) const {
+            const auto& a = points[t.v[0]];
+            const auto& b = points[t.v[1]];
+            const auto& c = points[t.v[2]];
+
+            auto adx = a.x - p.x, ady = a.y - p.y;
+            auto bdx = b.x - p.x, bdy = b.y - p.y;
+            auto cdx = c.x - p.x, cdy = c.y - p.y;
+            auto al = adx * adx + ady * ady - (a.w - p.w);
+            auto bl = bdx * bdx + bdy * bdy - (b.w - p.w);
+            auto cl = cdx * cdx + cdy * cdy - (c.w - p.w);
+
+            return adx * (bdy * cl - bl * cdy) - ady * (bdx * cl - bl * cdx) + al * (bdx * cdy - bdy * cdx) > 0;
+        }
+
+        // visibility walk, the starting edge rotates so degenerate configurations cannot cycle
+        std::uint32_t locate(const weighted_point_t& p) const {
+            auto t = _last;
+            for (std::size_t step = 0; step < triangles.size() + 3; ++step) {
+                const auto& tri = triangles[t];
+                auto next = no_triangle;
+                for (std::size_t k = 0; k < 3; ++k) {
+                    auto i = (k + step) % 3;
+                    if (orient(tri.v[(i + 1) % 3], tri.v[(i + 2) % 3], p) < 0) {
+                        next = tri.n[i];
+                        break;
+                    }
+                }
+                if (next == no_triangle)
+                    return t;
+                t = next;
+            }
+            return t;
+        }
+
+        std::uint32_t new_triangle(const triangle_t& t) {
+            if (!_free.empty()) {
+                auto i = _free.back();
+                _free.pop_back();
+                triangles[i] = t;
+                return i;
+            }
+
+            triangles.push_back(t);
+            if (_marks.size() < triangles.size())
+                _marks.resize(triangles.capacity(), 0);
+            return static_cast<std::uint32_t>(triangles.size() - 1);
+        }
+
+        bool in_cavity(std::uint32_t t) const { return t != no_triangle && _marks[t] == _stamp; }
+
+        void insert(std::uint32_t index) {
+            const auto& p = points[index];
+
+            auto start = locate(p);
+            if (!conflicts(triangles[start], p))
+                return; // redundant
+
+            if (++_stamp == 0) {
+                std::ranges::fill(_marks, 0);
+                _stamp = 1;
+            }
+
+            // grow the cavity over the connected conflicting triangles
+            _cavity.clear();
+            _cavity.push_back(start);
+            _marks[start] = _stamp;
+            for (std::size_t c = 0; c < _cavity.size(); ++c) {
+                for (auto nb : triangles[_cavity[c]].n) {
+                    if (nb == no_triangle || _marks[nb] == _stamp || !conflicts(triangles[nb], p))
+                        continue;
+                    _marks[nb] = _stamp;
+                    _cavity.push_back(nb);
+                }
+            }
+
+            // rounding can break the cavity's star shape around p, drop the triangles with a boundary edge p cannot see
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                for (std::size_t c = 1; c < _cavity.size(); ++c) {
+                    const auto& tri = triangles[_cavity[c]];
+                    for (std::size_t i = 0; i < 3; ++i) {
+                        if (in_cavity(tri.n[i]) || orient(tri.v[(i + 1) % 3], tri.v[(i + 2) % 3], p) > 0)
+                            continue;
+                        _marks[_cavity[c]] = _stamp - 1;
+                        _cavity[c] = _cavity.back();
+                        _cavity.pop_back();
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+
+            _boundary.clear();
+            for (auto c : _cavity) {
+                const auto& tri = triangles[c];
+                for (std::size_t i = 0; i < 3; ++i)
+                    if (!in_cavity(tri.n[i]))
+                        _boundary.push_back({ tri.v[(i + 1) % 3], tri.v[(i + 2) % 3], tri.n[i] });
+            }
+
+            for (auto c : _cavity) {
+                triangles[c].alive = false;
+                _free.push_back(c);
+            }
+
+            // fan the boundary around p; each boundary vertex starts exactly one edge, which links the fan
+            for (const auto& edge : _boundary) {
+                auto t = new_triangle({ { index, edge.a, edge.b }, { edge.outside, no_triangle, no_triangle }, true });
+                if (edge.outside != no_triangle) {
+                    auto& outside = triangles[edge.outside];
+                    auto j = (index_of(outside, edge.a) + 1) % 3; // the vertex opposite the edge b -> a in outside
+                    outside.n[j] = t;
+                }
+                _links[edge.a] = t;
+                _last = t;
+            }
+
+            for (const auto& edge : _boundary) {
+                auto t = _links[edge.a];
+                auto next = _links[edge.b];
+                triangles[t].n[1] = next;     // across b -> p
+                triangles[next].n[2] = t;     // across p -> a of the next triangle
+            }
+        }
+    };
+
+} // namespace dvoronoi::power::_details
+
+#endif //DVORONOI_POWER_TRIANGULATION_HPP
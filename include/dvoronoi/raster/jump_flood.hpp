@@ -0,0 +1,274 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_RASTER_JUMP_FLOOD_HPP
+#define DVORONOI_RASTER_JUMP_FLOOD_HPP
+
+#include <bit>
+#include <span>
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cassert>
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#include "dvoronoi/common/parallel.hpp"
+#include "rasterize.hpp"
+
+namespace dvoronoi::raster {
+
+    namespace _details {
+
+        // per pixel the best site seen so far, its position kept alongside the label so a pass reads the candidates'
+        // coordinates from contiguous rows rather than gathering them by label
+        struct flood_grid_t {
+            std::vector<float> x{}, y{};
+            std::vector<label_t> label{};
+
+            void assign(std::size_t size) {
+                constexpr auto far = 1e18f; // squares stay finite
+                x.assign(size, far);
+                y.assign(size, far);
+                label.assign(size, no_label);
+            }
+        };
+
+        // the candidates of one pass: the pixels step apart around the one at hand, its own first, the order
+        // deciding equally near candidates the same way in the vector and the scalar columns
+        struct flood_row_t {
+            const float* x[3]{};
+            const float* y[3]{};
+            const label_t* label[3]{};
+            std::size_t rows{0}; // the source rows inside the grid
+            std::ptrdiff_t own{0};
+        };
+
+        inline void flood_column(const flood_row_t& source, std::size_t column, std::ptrdiff_t step, std::size_t width, float yc, float pixel_w,
+                                 float* out_x, float* out_y, label_t* out_label) {
+            const auto xc = (static_cast<float>(column) + 0.5f) * pixel_w;
+            const auto c = static_cast<std::ptrdiff_t>(column);
+
+            auto bx = source.x[source.own][c], by = source.y[source.own][c];
+            auto bl = source.label[source.own][c];
+            auto bd = (bx - xc) * (bx - xc) + (by - yc) * (by - yc);
+
+            for (std::size_t r = 0; r < source.rows; ++r) {
+                for (auto cc : { c - step, c, c + step }) {
+                    if ((static_cast<std::ptrdiff_t>(r) == source.own && cc == c) || cc < 0 || cc >= static_cast<std::ptrdiff_t>(width))
+                        continue;
+
+                    const auto x = source.x[r][cc], y = source.y[r][cc];
+                    const auto d = (x - xc) * (x - xc) + (y - yc) * (y - yc);
+                    if (d < bd) {
+                        bd = d;
+                        bx = x;
+                        by = y;
+                        bl = source.label[r][cc];
+                    }
+                }
+            }
+
+            out_x[column] = bx;
+            out_y[column] = by;
+            out_label[column] = bl;
+        }
+
+        // the columns whose candidates all lie inside the row, [begin, end), a vector's worth at a time; returns
+        // the first column left over
+        inline std::size_t flood_columns(const flood_row_t& source, std::size_t begin, std::size_t end, std::ptrdiff_t step, float yc, float pixel_w,
+                                         float* out_x, float* out_y, label_t* out_label) {
+#if defined(__AVX2__)
+            constexpr std::size_t lanes = 8;
+            const auto half = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+            const auto pw = _mm256_set1_ps(pixel_w), py = _mm256_set1_ps(yc);
+
+            for (; begin + lanes <= end; begin += lanes) {
+                const auto c = static_cast<std::ptrdiff_t>(begin);
+                const auto xc = _mm256_mul_ps(_mm256_add_ps(_mm256_set1_ps(static_cast<float>(begin)), half), pw);
+
+                auto bx = _mm256_loadu_ps(source.x[source.own] + c), by = _mm256_loadu_ps(source.y[source.own] + c);
+                auto bl = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source.label[source.own] + c)));
+                auto ex = _mm256_sub_ps(bx, xc), ey = _mm256_sub_ps(by, py);
+                auto bd = _mm256_add_ps(_mm256_mul_ps(ex, ex), _mm256_mul_ps(ey, ey));
+
+                for (std::size_t r = 0; r < source.rows; ++r) {
+                    for (auto cc : { c - step, c, c + step }) {
+                        if (static_cast<std::ptrdiff_t>(r) == source.own && cc == c)
+                            continue;
+
+                        const auto x = _mm256_loadu_ps(source.x[r] + cc), y = _mm256_loadu_ps(source.y[r] + cc);
+                        const auto l = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source.label[r] + cc)));
+                        ex = _mm256_sub_ps(x, xc);
+                        ey = _mm256_sub_ps(y, py);
+                        const auto d = _mm256_add_ps(_mm256_mul_ps(ex, ex), _mm256_mul_ps(ey, ey));
+                        const auto better = _mm256_cmp_ps(d, bd, _CMP_LT_OQ);
+                        bd = _mm256_blendv_ps(bd, d, better);
+                        bx = _mm256_blendv_ps(bx, x, better);
+                        by = _mm256_blendv_ps(by, y, better);
+                        bl = _mm256_blendv_ps(bl, l, better);
+                    }
+                }
+
+                _mm256_storeu_ps(out_x + c, bx);
+                _mm256_storeu_ps(out_y + c, by);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_label + c), _mm256_castps_si256(bl));
+            }
+#elif defined(__SSE2__) || defined(_M_X64)
+            constexpr std::size_t lanes = 4;
+            const auto half = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+            const auto pw = _mm_set1_ps(pixel_w), py = _mm_set1_ps(yc);
+            auto select = [](__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, a)); };
+
+            for (; begin + lanes <= end; begin += lanes) {
+                const auto c = static_cast<std::ptrdiff_t>(begin);
+                const auto xc = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(static_cast<float>(begin)), half), pw);
+
+                auto bx = _mm_loadu_ps(source.x[source.own] + c), by = _mm_loadu_ps(source.y[source.own] + c);
+                auto bl = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source.label[source.own] + c)));
+                auto ex = _mm_sub_ps(bx, xc), ey = _mm_sub_ps(by, py);
+                auto bd = _mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey));
+
+                for (std::size_t r = 0; r < source.rows; ++r) {
+                    for (auto cc : { c - step, c, c + step }) {
+                        if (static_cast<std::ptrdiff_t>(r) == source.own && cc == c)
+                            continue;
+
+                        const auto x = _mm_loadu_ps(source.x[r] + cc), y = _mm_loadu_ps(source.y[r] + cc);
+                        const auto l = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source.label[r] + cc)));
+                        ex = _mm_sub_ps(x, xc);
+                        ey = _mm_sub_ps(y, py);
+                        const auto d = _mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey));
+                        const auto better = _mm_cmplt_ps(d, bd);
+                        bd = select(better, bd, d);
+                        bx = select(better, bx, x);
+                        by = select(better, by, y);
+                        bl = select(better, bl, l);
+                    }
+                }
+
+                _mm_storeu_ps(out_x + c, bx);
+                _mm_storeu_ps(out_y + c, by);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out_label + c), _mm_castps_si128(bl));
+            }
+#endif
+            return begin;
+        }
+
+        // out's row takes, per pixel, the nearest of in's candidates at the 3 x 3 offsets step pixels apart; the
+        // columns far enough from the row's ends go through the vector path, the rest one by one
+        inline void flood_row(const flood_grid_t& in, flood_grid_t& out, std::size_t row, std::size_t step, std::size_t width, std::size_t height,
+                              float pixel_w, float pixel_h) {
+            const auto yc = (static_cast<float>(row) + 0.5f) * pixel_h;
+            auto* out_x = out.x.data() + row * width;
+            auto* out_y = out.y.data() + row * width;
+            auto* out_label = out.label.data() + row * width;
+
+            flood_row_t source;
+            const auto offset = static_cast<std::ptrdiff_t>(step);
+            const auto here = static_cast<std::ptrdiff_t>(row);
+            for (auto r : { here - offset, here, here + offset }) {
+                if (r < 0 || r >= static_cast<std::ptrdiff_t>(height))
+                    continue;
+
+                if (r == here)
+                    source.own = static_cast<std::ptrdiff_t>(source.rows);
+                source.x[source.rows] = in.x.data() + r * static_cast<std::ptrdiff_t>(width);
+                source.y[source.rows] = in.y.data() + r * static_cast<std::ptrdiff_t>(width);
+                source.label[source.rows] = in.label.data() + r * static_cast<std::ptrdiff_t>(width);
+                ++source.rows;
+            }
+
+            const auto inner_begin = std::min(step, width), inner_end = std::max(inner_begin, width - std::min(step, width));
+
+            for (std::size_t c = 0; c < inner_begin; ++c)
+                flood_column(source, c, offset, width, yc, pixel_w, out_x, out_y, out_label);
+            for (auto c = flood_columns(source, inner_begin, inner_end, offset, yc, pixel_w, out_x, out_y, out_label); c < width; ++c)
+                flood_column(source, c, offset, width, yc, pixel_w, out_x, out_y, out_label);
+        }
+
+    } // namespace _details
+
+    // approximate nearest site labels by jump flooding, for when the exact cells aren't needed: every site seeds the
+    // pixel containing it, or the nearest border pixel when outside the view, then passes with halving steps spread
+    // the nearest sites seen, plus a final one pixel pass to mend most of the flooding's errors. Distances are taken
+    // to the sites' exact positions, in single precision relative to the view's corner. Each pass is split by rows
+    // over the threads. distances, when given, gets the distance from every pixel center to its site, in view units
+    inline void jump_flood(const auto& sites, std::span<label_t> labels, const raster_config_t& config, std::span<float> distances = {}) {
+        const auto width = config.width, height = config.height;
+        assert(labels.size() >= width * height);
+        assert(distances.empty() || distances.size() >= width * height);
+        if (width == 0 || height == 0)
+            return;
+
+        const auto pixel_w = static_cast<float>((config.view.right - config.view.left) / static_cast<double>(width));
+        const auto pixel_h = static_cast<float>((config.view.top - config.view.bottom) / static_cast<double>(height));
+        const auto threads = parallel::thread_count(config.threads);
+
+        _details::flood_grid_t grids[2];
+        grids[0].assign(width * height);
+        grids[1].assign(width * height);
+
+        // seeds, the site nearest to the pixel center winning a shared pixel
+        auto& seeds = grids[0];
+        for (std::size_t i = 0; i < sites.size(); ++i) {
+            const auto x = static_cast<float>(static_cast<double>(sites[i].x) - config.view.left);
+            const auto y = static_cast<float>(static_cast<double>(sites[i].y) - config.view.bottom);
+            const auto c = static_cast<std::size_t>(std::clamp(std::floor(x / pixel_w), 0.0f, static_cast<float>(width - 1)));
+            const auto r = static_cast<std::size_t>(std::clamp(std::floor(y / pixel_h), 0.0f, static_cast<float>(height - 1)));
+            const auto p = r * width + c;
+
+            auto distance = [&](float sx, float sy) {
+                const auto ex = sx - (static_cast<float>(c) + 0.5f) * pixel_w, ey = sy - (static_cast<float>(r) + 0.5f) * pixel_h;
+                return ex * ex + ey * ey;
+            };
+            if (seeds.label[p] == no_label || distance(x, y) < distance(seeds.x[p], seeds.y[p])) {
+                seeds.x[p] = x;
+                seeds.y[p] = y;
+                seeds.label[p] = static_cast<label_t>(i);
+            }
+        }
+
+        std::vector<std::size_t> steps;
+        for (auto step = std::bit_floor(std::max(width, height) - 1); step >= 1; step /= 2)
+            steps.push_back(step);
+        steps.push_back(1);
+
+        std::size_t current = 0;
+        for (auto step : steps) {
+            const auto& in = grids[current];
+            auto& out = grids[1 - current];
+
+            parallel::parallel_for_chunks(height, [&](std::size_t begin, std::size_t end) {
+                for (auto r = begin; r < end; ++r)
+                    _details::flood_row(in, out, r, step, width, height, pixel_w, pixel_h);
+            }, threads, 16);
+
+            current = 1 - current;
+        }
+
+        const auto& result = grids[current];
+        parallel::parallel_for_chunks(height, [&](std::size_t begin, std::size_t end) {
+            for (auto r = begin; r < end; ++r) {
+                for (std::size_t c = 0; c < width; ++c) {
+                    const auto p = r * width + c;
+                    labels[p] = result.label[p] == no_label ? config.background : result.label[p];
+                    if (!distances.empty()) {
+                        const auto ex = result.x[p] - (static_cast<float>(c) + 0.5f) * pixel_w;
+                        const auto ey = result.y[p] - (static_cast<float>(r) + 0.5f) * pixel_h;
+                        distances[p] = result.label[p] == no_label ? std::numeric_limits<float>::infinity() : std::sqrt(ex * ex + ey * ey);
+                    }
+                }
+            }
+        }, threads, 16);
+    }
+
+} // namespace dvoronoi::raster
+
+#endif //DVORONOI_RASTER_JUMP_FLOOD_HPP
@@ -0,0 +1,188 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_RASTER_RASTERIZE_HPP
+#define DVORONOI_RASTER_RASTERIZE_HPP
+
+#include <span>
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cassert>
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#include "dvoronoi/common/box.hpp"
+#include "dvoronoi/common/parallel.hpp"
+
+namespace dvoronoi::raster {
+
+    typedef std::uint32_t label_t;
+    constexpr label_t no_label = std::numeric_limits<label_t>::max();
+
+    // maps the view box onto a width x height label image, row r and column c sample the point
+    // (view.left + (c + 0.5) * pixel width, view.bottom + (r + 0.5) * pixel height), rows are stored contiguously
+    struct raster_config_t {
+        box_t view{};
+        std::size_t width{0};
+        std::size_t height{0};
+        label_t background{no_label}; // written to the pixels not covered by any cell
+        std::size_t threads{0};       // 0 means hardware concurrency
+    };
+
+    namespace _details {
+
+        inline void fill_span(label_t* dst, std::size_t count, label_t label) {
+#if defined(__AVX2__)
+            const auto value = _mm256_set1_epi32(static_cast<int>(label));
+            for (; count >= 8; count -= 8, dst += 8)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), value);
+#elif defined(__SSE2__) || defined(_M_X64)
+            const auto value = _mm_set1_epi32(static_cast<int>(label));
+            for (; count >= 4; count -= 4, dst += 4)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), value);
+#endif
+            for (; count > 0; --count)
+                *dst++ = label;
+        }
+
+        struct face_rows_t {
+            std::size_t face;
+            std::size_t first_row;
+            std::size_t last_row; // exclusive
+        };
+
+        // cells are convex, so every row crosses a face in a single span: the edge table keeps the leftmost and
+        // rightmost crossing per row. Edges are always evaluated from their lower end point, so the two faces sharing
+        // an edge compute bit-identical crossings and the half-open spans neither overlap nor leave gaps.
+        inline void fill_face(const auto& face, label_t label, std::size_t first_row, std::size_t last_row,
+                              std::span<label_t> labels, const raster_config_t& config,
+                              std::vector<double>& left, std::vector<double>& right) {
+            const auto pixel_w = (config.view.right - config.view.left) / static_cast<double>(config.width);
+            const auto pixel_h = (config.view.top - config.view.bottom) / static_cast<double>(config.height);
+
+            const auto rows = last_row - first_row;
+            left.assign(rows, std::numeric_limits<double>::infinity());
+            right.assign(rows, -std::numeric_limits<double>::infinity());
+
+            auto he = face.half_edge;
+            do {
+                auto p0 = he->orig->point;
+                auto p1 = he->dest->point;
+                if (p1.y < p0.y || (p1.y == p0.y && p1.x < p0.x))
+                    std::swap(p0, p1);
+
+                // rows whose center lies in [p0.y, p1.y)
+                auto y0 = (p0.y - config.view.bottom) / pixel_h - 0.5;
+                auto y1 = (p1.y - config.view.bottom) / pixel_h - 0.5;
+                auto r0 = std::max<double>(std::ceil(y0), static_cast<double>(first_row));
+                auto r1 = std::min<double>(std::ceil(y1), static_cast<double>(last_row));
+
+                if (r0 < r1) {
+                    auto dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+                    for (auto r = static_cast<std::size_t>(r0); r < static_cast<std::size_t>(r1); ++r) {
+                        auto yc = config.view.bottom + (static_cast<double>(r) + 0.5) * pixel_h;
+                        auto x = p0.x + (yc - p0.y) * dxdy;
+                        left[r - first_row] = std::min(left[r - first_row], x);
+                        right[r - first_row] = std::max(right[r - first_row], x);
+                    }
+                }
+
+                he = he->next;
+            } while (he != face.half_edge);
+
+            for (std::size_t i = 0; i < rows; ++i) {
+                if (!(left[i] < right[i]))
+                    continue;
+
+                // columns whose center lies in [left, right)
+                auto c0 = std::max(0.0, std::ceil((left[i] - config.view.left) / pixel_w - 0.5));
+                auto c1 = std::min(static_cast<double>(config.width), std::ceil((right[i] - config.view.left) / pixel_w - 0.5));
+                if (c0 >= c1)
+                    continue;
+
+                auto row = labels.data() + (first_row + i) * config.width;
+                fill_span(row + static_cast<std::size_t>(c0), static_cast<std::size_t>(c1 - c0), label);
+            }
+        }
+
+        inline bool is_closed(const auto& face) {
+            if (face.half_edge == nullptr)
+                return false;
+
+            auto he = face.half_edge;
+            do {
+                if (he->orig == nullptr || he->dest == nullptr || he->next == nullptr)
+                    return false;
+                he = he->next;
+            } while (he != face.half_edge);
+
+            return true;
+        }
+
+    } // namespace _details
+
+    // fills labels (config.width * config.height entries) with the index of the cell covering every pixel center;
+    // rows are split into bands, one band per task, so the threads never write to the same pixels
+    inline void rasterize(const auto& diag, std::span<label_t> labels, const raster_config_t& config) {
+        assert(labels.size() >= config.width * config.height);
+
+        const auto threads = parallel::thread_count(config.threads);
+        const auto bands_count = std::min<std::size_t>(config.height, 4 * threads);
+        if (bands_count == 0)
+            return;
+        const auto band_rows = (config.height + bands_count - 1) / bands_count;
+
+        const auto pixel_h = (config.view.top - config.view.bottom) / static_cast<double>(config.height);
+
+        // row range of every closed face, bucketed by the bands it overlaps
+        std::vector<std::vector<_details::face_rows_t>> bands(bands_count);
+        for (std::size_t f = 0; f < diag.faces.size(); ++f) {
+            const auto& face = diag.faces[f];
+            if (!_details::is_closed(face))
+                continue;
+
+            auto y_min = std::numeric_limits<double>::infinity();
+            auto y_max = -std::numeric_limits<double>::infinity();
+            auto he = face.half_edge;
+            do {
+                y_min = std::min(y_min, he->orig->point.y);
+                y_max = std::max(y_max, he->orig->point.y);
+                he = he->next;
+            } while (he != face.half_edge);
+
+            auto first_row = std::clamp(std::ceil((y_min - config.view.bottom) / pixel_h - 0.5), 0.0, static_cast<double>(config.height));
+            auto last_row = std::clamp(std::ceil((y_max - config.view.bottom) / pixel_h - 0.5), 0.0, static_cast<double>(config.height));
+            if (first_row >= last_row)
+                continue;
+
+            auto first = static_cast<std::size_t>(first_row);
+            auto last = static_cast<std::size_t>(last_row);
+            for (auto b = first / band_rows; b * band_rows < last; ++b)
+                bands[b].push_back({ f, std::max(first, b * band_rows), std::min(last, (b + 1) * band_rows) });
+        }
+
+        parallel::parallel_for(bands_count, [&](std::size_t b) {
+            auto first_row = b * band_rows;
+            auto last_row = std::min(config.height, first_row + band_rows);
+            if (first_row >= last_row)
+                return;
+
+            _details::fill_span(labels.data() + first_row * config.width, (last_row - first_row) * config.width, config.background);
+
+            std::vector<double> left, right;
+            for (const auto& face_rows : bands[b])
+                _details::fill_face(diag.faces[face_rows.face], static_cast<label_t>(face_rows.face), face_rows.first_row, face_rows.last_row, labels, config, left, right);
+        }, threads);
+    }
+
+} // namespace dvoronoi::raster
+
+#endif //DVORONOI_RASTER_RASTERIZE_HPP
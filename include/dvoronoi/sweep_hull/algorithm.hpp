@@ -0,0 +1,106 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_SWEEP_HULL_ALGORITHM_HPP
+#define DVORONOI_SWEEP_HULL_ALGORITHM_HPP
+
+#include <memory>
+#include <cassert>
+
+#include "dvoronoi/common/diagram.hpp"
+#include "dvoronoi/common/clipping.hpp"
+#include "dvoronoi/common/dual.hpp"
+#include "dvoronoi/common/reorder.hpp"
+#include "dvoronoi/common/merge.hpp"
+#include "dvoronoi/fortune/algorithm.hpp"
+
+#include "triangulation.hpp"
+
+namespace dvoronoi::sweep_hull {
+
+    // Voronoi diagrams from the Delaunay triangulation, built first by a radial sweep and then dualized into the same
+    // diagram type, from the same config, as fortune::algorithm, so either can be a template argument. Cells are always
+    // bounded, like the power diagrams': by config's bounding box, or the sites' extents when it is missing, enlarged to
+    // contain every vertex like bound() does, or clipped to the bounding box itself when config.clip is set. Sites
+    // equal to another one get a face with a null half_edge, unless config merges them.
+    class algorithm {
+    public:
+        typedef voronoi_diagram_t diagram_t;
+        using voronoi_diagram_h = std::unique_ptr<diagram_t>;
+        typedef fortune::config_t config_t;
+
+        static auto generate(const auto& sites, const config_t& config = config_t{}) -> voronoi_diagram_h {
+            assert(!sites.empty());
+
+            if (config.merge_tolerance.has_value()) {
+                auto merged = merge_sites(sites, config.merge_tolerance.value());
+
+                auto unmerged = config;
+                unmerged.merge_tolerance.reset();
+                auto diagram = generate(merged.points, unmerged);
+                diagram->input_faces = std::make_unique<diagram_t::input_faces_t>(std::move(merged.representative));
+                return diagram;
+            }
+
+            if (config.periodic.has_value()) {
+                auto diagram = fortune::_details::generate_periodic<voronoi_diagram_h>(sites, config.periodic.value(), [](const auto& extended, const box_t& region) {
+                    return generate(extended, config_t{ region });
+                });
+
+                if (config.face_major)
+                    compact_rings(*diagram);
+                return diagram;
+            }
+
+            const auto n = sites.size();
+
+            auto extents = box_t{ sites[0].x, sites[0].y, sites[0].x, sites[0].y };
+            for (std::size_t i = 0; i < n; ++i) {
+                extents.left = std::min<data::scalar_t>(extents.left, sites[i].x);
+                extents.bottom = std::min<data::scalar_t>(extents.bottom, sites[i].y);
+                extents.right = std::max<data::scalar_t>(extents.right, sites[i].x);
+                extents.top = std::max<data::scalar_t>(extents.top, sites[i].y);
+            }
+
+            auto box = config.bounding_box.value_or(extents);
+            auto ghost_box = box_t{ std::min(box.left, extents.left), std::min(box.bottom, extents.bottom),
+                                    std::max(box.right, extents.right), std::max(box.top, extents.top) };
+
+            _details::delaunay_triangulation_t triangulation;
+            triangulation.init(n, [&sites](std::size_t i) {
+                return data::point_t{ static_cast<data::scalar_t>(sites[i].x), static_cast<data::scalar_t>(sites[i].y) };
+            }, ghost_box);
+            triangulation.build();
+
+            auto diagram = std::make_unique<diagram_t>(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                diagram->sites.emplace_back(i, sites[i].x, sites[i].y);
+                diagram->faces.emplace_back(&diagram->sites.back());
+                diagram->sites.back().face = &diagram->faces.back();
+            }
+
+            dvoronoi::_details::build_dual_cells(triangulation, *diagram);
+
+            if (config.clip && config.bounding_box.has_value())
+                voronoi::clip(*diagram, convex_polygon_t::from_box(box));
+            else
+                voronoi::clip(*diagram, convex_polygon_t::from_box(dvoronoi::_details::enclose_dual_vertices(triangulation, box)));
+
+            if (config.face_major)
+                compact_rings(*diagram);
+
+            return diagram;
+        }
+
+        static bool clip(auto& diag, const box_t& box) { return voronoi::clip(diag, box); }
+        static bool clip(auto& diag, const convex_polygon_t& polygon, std::size_t threads = 0) { return voronoi::clip(diag, polygon, threads); }
+
+        static auto generate_delaunay(const voronoi_diagram_h& voronoi_diagram, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+            return fortune::algorithm::generate_delaunay(voronoi_diagram, resource);
+        }
+    };
+
+} // namespace dvoronoi::sweep_hull
+
+#endif //DVORONOI_SWEEP_HULL_ALGORITHM_HPP
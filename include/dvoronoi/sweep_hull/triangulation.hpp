@@ -0,0 +1,398 @@
+//
+// Created by Daniel Secrieru on 19/10/2026.
+//
+
+#ifndef DVORONOI_SWEEP_HULL_TRIANGULATION_HPP
+#define DVORONOI_SWEEP_HULL_TRIANGULATION_HPP
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <numeric>
+#include <algorithm>
+
+#include "dvoronoi/common/data.hpp"
+#include "dvoronoi/common/box.hpp"
+
+namespace dvoronoi::sweep_hull::_details {
+
+    typedef data::scalar_t scalar_t;
+    typedef data::point_t point_t;
+
+    constexpr std::uint32_t no_index = std::numeric_limits<std::uint32_t>::max();
+
+    struct triangle_t {
+        std::array<std::uint32_t, 3> v; // counter-clockwise
+        std::array<std::uint32_t, 3> n; // n[i] is the triangle across the edge opposite v[i]
+        bool alive;
+    };
+
+    // Delaunay triangulation by a radial sweep (s-hull, the way delaunator does it): the points are added by increasing
+    // distance from a seed triangle's circumcenter, so each one lies outside the hull so far. It is joined to the hull
+    // edges it sees, found from a hash of the hull vertices' angles around the center, and the new triangles are made
+    // Delaunay by flipping. Four ghosts far around the points end up as the hull, so every real point gets a closed fan
+    // of triangles. Points equal to the one before them, or not seeing any hull edge, are skipped and in no triangle.
+    class delaunay_triangulation_t {
+    public:
+        std::vector<point_t> points{};
+        std::vector<triangle_t> triangles{};
+        std::size_t ghosts_begin{0};
+
+        // the points to triangulate, followed by the four ghosts: a square around box
+        void init(std::size_t count, const auto& point_at, const box_t& box) {
+            points.clear();
+            points.reserve(count + 4);
+            for (std::size_t i = 0; i < count; ++i)
+                points.push_back(point_at(i));
+
+            const auto cx = (box.left + box.right) / 2, cy = (box.bottom + box.top) / 2;
+            const auto r = 16 * std::max({ box.right - box.left, box.top - box.bottom, scalar_t(1) });
+
+            ghosts_begin = count;
+            points.push_back({ cx - r, cy - r });
+            points.push_back({ cx + r, cy - r });
+            points.push_back({ cx + r, cy + r });
+            points.push_back({ cx - r, cy + r });
+        }
+
+        void build() {
+            const auto n = static_cast<std::uint32_t>(points.size());
+
+            auto [i0, i1, i2] = seed();
+            _center = circumcenter(points[i0], points[i1], points[i2]);
+
+            _distances.resize(n);
+            _order.resize(n);
+            for (std::uint32_t i = 0; i < n; ++i) {
+                _distances[i] = squared(points[i] - _center);
+                _order[i] = i;
+            }
+
+            // equal points end up next to each other
+            std::ranges::sort(_order, [this](std::uint32_t a, std::uint32_t b) {
+                if (_distances[a] != _distances[b])
+                    return _distances[a] < _distances[b];
+                return points[a].x < points[b].x || (points[a].x == points[b].x && (points[a].y < points[b].y || (points[a].y == points[b].y && a < b)));
+            });
+
+            _vertex.clear();
+            _twin.clear();
+            _vertex.reserve(6 * static_cast<std::size_t>(n));
+            _twin.reserve(6 * static_cast<std::size_t>(n));
+
+            _hull_next.assign(n, no_index);
+            _hull_prev.assign(n, no_index);
+            _hull_tri.assign(n, no_index);
+            _hash.assign(static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(n)))), no_index);
+
+            _hull_start = i0;
+            _hull_next[i0] = _hull_prev[i2] = i1;
+            _hull_next[i1] = _hull_prev[i0] = i2;
+            _hull_next[i2] = _hull_prev[i1] = i0;
+            _hull_tri[i0] = 0;
+            _hull_tri[i1] = 1;
+            _hull_tri[i2] = 2;
+            _hash[hash_key(points[i0])] = i0;
+            _hash[hash_key(points[i1])] = i1;
+            _hash[hash_key(points[i2])] = i2;
+
+            add_triangle(i0, i1, i2, no_index, no_index, no_index);
+
+            for (std::size_t k = 0; k < n; ++k) {
+                const auto i = _order[k];
+                const auto& p = points[i];
+
+                if (k > 0 && p.x == points[_order[k - 1]].x && p.y == points[_order[k - 1]].y)
+                    continue;
+                if (i == i0 || i == i1 || i == i2)
+                    continue;
+
+                // a hull vertex near p's angle, then the first hull edge p sees from there on
+                std::uint32_t start = 0;
+                const auto key = hash_key(p);
+                for (std::size_t j = 0; j < _hash.size(); ++j) {
+                    start = _hash[(key + j) % _hash.size()];
+                    if (start != no_index && start != _hull_next[start])
+                        break;
+                }
+
+                start = _hull_prev[start];
+                auto e = start;
+                auto q = _hull_next[e];
+                while (orient(points[e], points[q], p) >= 0) {
+                    e = q;
+                    if (e == start) {
+                        e = no_index;
+                        break;
+                    }
+                    q = _hull_next[e];
+                }
+                if (e == no_index)
+                    continue; // nearly a duplicate
+
+                auto t = add_triangle(e, i, _hull_next[e], no_index, no_index, _hull_tri[e]);
+                _hull_tri[i] = legalize(t + 2);
+                _hull_tri[e] = t;
+
+                // the hull edges after e that p sees too
+                auto next = _hull_next[e];
+                q = _hull_next[next];
+                while (orient(points[next], points[q], p) < 0) {
+                    t = add_triangle(next, i, q, _hull_tri[i], no_index, _hull_tri[next]);
+                    _hull_tri[i] = legalize(t + 2);
+                    _hull_next[next] = next; // off the hull
+                    next = q;
+                    q = _hull_next[next];
+                }
+
+                // and before it, when the search started right at a visible one
+                if (e == start) {
+                    q = _hull_prev[e];
+                    while (orient(points[q], points[e], p) < 0) {
+                        t = add_triangle(q, i, e, no_index, _hull_tri[e], _hull_tri[q]);
+                        legalize(t + 2);
+                        _hull_tri[q] = t;
+                        _hull_next[e] = e;
+                        e = q;
+                        q = _hull_prev[e];
+                    }
+                }
+
+                _hull_start = _hull_prev[i] = e;
+                _hull_next[e] = _hull_prev[next] = i;
+                _hull_next[i] = next;
+
+                _hash[hash_key(p)] = i;
+                _hash[hash_key(points[e])] = e;
+            }
+
+            const auto count = _vertex.size() / 3;
+            triangles.resize(count);
+            for (std::size_t t = 0; t < count; ++t) {
+                auto& tri = triangles[t];
+                for (std::size_t i = 0; i < 3; ++i) {
+                    tri.v[i] = _vertex[3 * t + i];
+                    const auto across = _twin[3 * t + (i + 1) % 3];
+                    tri.n[i] = across == no_index ? no_index : across / 3;
+                }
+                tri.alive = true;
+            }
+        }
+
+        [[nodiscard]] bool is_ghost(std::uint32_t v) const { return v >= ghosts_begin; }
+
+        // the circumcenter, i.e. the power center of unweighted points
+        [[nodiscard]] point_t power_center(const triangle_t& t) const {
+            return circumcenter(points[t.v[0]], points[t.v[1]], points[t.v[2]]);
+        }
+
+        static std::size_t index_of(const triangle_t& t, std::uint32_t v) {
+            return t.v[0] == v ? 0 : (t.v[1] == v ? 1 : 2);
+        }
+
+    private:
+        point_t _center{};
+        std::vector<scalar_t> _distances{};
+        std::vector<std::uint32_t> _order{};
+
+        // half edges, three per triangle in counter-clockwise order: the vertex each starts from and its twin
+        std::vector<std::uint32_t> _vertex{};
+        std::vector<std::uint32_t> _twin{};
+
+        // the hull, counter-clockwise, as a linked list over the points; _hull_tri is the half edge leaving a hull
+        // vertex along the hull, _hull_next of a point taken off the hull is the point itself
+        std::uint32_t _hull_start{0};
+        std::vector<std::uint32_t> _hull_next{};
+        std::vector<std::uint32_t> _hull_prev{};
+        std::vector<std::uint32_t> _hull_tri{};
+        std::vector<std::uint32_t> _hash{};
+        std::vector<std::uint32_t> _edges{};
+
+        static scalar_t squared(const point_t& d) { return d.x * d.x + d.y * d.y; }
+
+        static point_t circumcenter(const point_t& a, const point_t& b, const point_t& c) {
+            auto bx = b.x - a.x, by = b.y - a.y;
+            auto cx = c.x - a.x, cy = c.y - a.y;
+            auto bl = bx * bx + by * by;
+            auto cl = cx * cx + cy * cy;
+            auto d = 2 * (bx * cy - by * cx);
+
+            return { a.x + (cy * bl - by * cl) / d, a.y + (bx * cl - cx * bl) / d };
+        }
+
+        // twice the signed area of a, b, c, positive counter-clockwise; computed from each corner in turn until the
+        // rounding error bound says the sign is right, 0 when it never does
+        static scalar_t orient(const point_t& a, const point_t& b, const point_t& c) {
+            auto sure = [](const point_t& p, const point_t& q, const point_t& r) {
+                auto l = (q.x - p.x) * (r.y - p.y);
+                auto m = (q.y - p.y) * (r.x - p.x);
+                return std::abs(l - m) >= 3.3306690738754716e-16 * std::abs(l + m) ? l - m : 0;
+            };
+
+            auto o = sure(a, b, c);
+            if (o == 0)
+                o = sure(b, c, a);
+            if (o == 0)
+                o = sure(c, a, b);
+            return o;
+        }
+
+        // whether d is inside the circle through the counter-clockwise a, b, c
+        static bool in_circle(const point_t& a, const point_t& b, const point_t& c, const point_t& d) {
+            auto adx = a.x - d.x, ady = a.y - d.y;
+            auto bdx = b.x - d.x, bdy = b.y - d.y;
+            auto cdx = c.x - d.x, cdy = c.y - d.y;
+            auto al = adx * adx + ady * ady;
+            auto bl = bdx * bdx + bdy * bdy;
+            auto cl = cdx * cdx + cdy * cdy;
+
+            return adx * (bdy * cl - bl * cdy) - ady * (bdx * cl - bl * cdx) + al * (bdx * cdy - bdy * cdx) > 0;
+        }
+
+        // the point closest to the center of all of them, its nearest neighbour and the third point making the
+        // smallest circle with them, counter-clockwise; the ghosts guarantee one exists
+        std::array<std::uint32_t, 3> seed() const {
+            auto min_x = points[0].x, min_y = points[0].y, max_x = min_x, max_y = min_y;
+            for (const auto& p : points) {
+                min_x = std::min(min_x, p.x);
+                min_y = std::min(min_y, p.y);
+                max_x = std::max(max_x, p.x);
+                max_y = std::max(max_y, p.y);
+            }
+            const auto center = point_t{ (min_x + max_x) / 2, (min_y + max_y) / 2 };
+
+            const auto n = static_cast<std::uint32_t>(points.size());
+            auto closest = [this, n](auto&& distance) {
+                std::uint32_t best = 0;
+                auto best_distance = std::numeric_limits<scalar_t>::infinity();
+                for (std::uint32_t i = 0; i < n; ++i) {
+                    auto d = distance(i);
+                    if (d < best_distance) {
+                        best = i;
+                        best_distance = d;
+                    }
+                }
+                return best;
+            };
+
+            const auto i0 = closest([this, &center](std::uint32_t i) { return squared(points[i] - center); });
+            const auto i1 = closest([this, i0](std::uint32_t i) {
+                auto d = squared(points[i] - points[i0]);
+                return d > 0 ? d : std::numeric_limits<scalar_t>::infinity();
+            });
+            const auto i2 = closest([this, i0, i1](std::uint32_t i) {
+                if (i == i0 || i == i1 || orient(points[i0], points[i1], points[i]) == 0)
+                    return std::numeric_limits<scalar_t>::infinity();
+                return squared(circumcenter(points[i0], points[i1], points[i]) - points[i0]);
+            });
+
+            if (orient(points[i0], points[i1], points[i2]) < 0)
+                return { i0, i2, i1 };
+            return { i0, i1, i2 };
+        }
+
+        // the pseudo angle of p around the center, as a bucket
+        [[nodiscard]] std::size_t hash_key(const point_t& p) const {
+            const auto dx = p.x - _center.x, dy = p.y - _center.y;
+            const auto s = std::abs(dx) + std::abs(dy);
+            if (s == 0)
+                return 0;
+
+            const auto r = dx / s;
+            const auto angle = (dy > 0 ? 3 - r : 1 + r) / 4; // in [0, 1)
+            return static_cast<std::size_t>(std::floor(angle * static_cast<scalar_t>(_hash.size()))) % _hash.size();
+        }
+
+        void link(std::uint32_t a, std::uint32_t b) {
+            _twin[a] = b;
+            if (b != no_index)
+                _twin[b] = a;
+        }
+
+        std::uint32_t add_triangle(std::uint32_t i0, std::uint32_t i1, std::uint32_t i2, std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+            const auto t = static_cast<std::uint32_t>(_vertex.size());
+            _vertex.insert(_vertex.end(), { i0, i1, i2 });
+            _twin.insert(_twin.end(), { no_index, no_index, no_index });
+            link(t, a);
+            link(t + 1, b);
+            link(t + 2, c);
+            return t;
+        }
+
+        // flips the edge a and the ones it uncovers until they are all Delaunay; returns the half edge now before a in
+        // its triangle, which is where the hull edge ending at the new point went
+        std::uint32_t legalize(std::uint32_t a) {
+            std::uint32_t ar = 0;
+            _edges.clear();
+
+            //           pl                    pl
+            //          /||\                  /  \
+            //       al/ || \bl            al/    \a
+            //        /  ||  \              /      \
+            //       /  a||b  \    flip    /___ar___\
+            //     p0\   ||   /p1   =>   p0\---bl---/p1
+            //        \  ||  /              \      /
+            //       ar\ || /br             b\    /br
+            //          \||/                  \  /
+            //           pr                    pr
+            while (true) {
+                const auto b = _twin[a];
+                const auto a0 = a - a % 3;
+                ar = a0 + (a + 2) % 3;
+
+                if (b == no_index) {
+                    if (_edges.empty())
+                        break;
+                    a = _edges.back();
+                    _edges.pop_back();
+                    continue;
+                }
+
+                const auto b0 = b - b % 3;
+                const auto al = a0 + (a + 1) % 3;
+                const auto bl = b0 + (b + 2) % 3;
+
+                const auto p0 = _vertex[ar];
+                const auto pr = _vertex[a];
+                const auto pl = _vertex[al];
+                const auto p1 = _vertex[bl];
+
+                if (in_circle(points[p0], points[pr], points[pl], points[p1])) {
+                    _vertex[a] = p1;
+                    _vertex[b] = p0;
+
+                    // the edge p1 -> pl may be on the hull, it moves from bl to a
+                    const auto hbl = _twin[bl];
+                    if (hbl == no_index) {
+                        auto e = _hull_start;
+                        do {
+                            if (_hull_tri[e] == bl) {
+                                _hull_tri[e] = a;
+                                break;
+                            }
+                            e = _hull_prev[e];
+                        } while (e != _hull_start);
+                    }
+
+                    link(a, hbl);
+                    link(b, _twin[ar]);
+                    link(ar, bl);
+
+                    _edges.push_back(b0 + (b + 1) % 3);
+                } else {
+                    if (_edges.empty())
+                        break;
+                    a = _edges.back();
+                    _edges.pop_back();
+                }
+            }
+
+            return ar;
+        }
+    };
+
+} // namespace dvoronoi::sweep_hull::_details
+
+#endif //DVORONOI_SWEEP_HULL_TRIANGULATION_HPP